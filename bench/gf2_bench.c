@@ -0,0 +1,144 @@
+/*
+ * File:   gf2_bench.c
+ *
+ * Created on October 17, 2026
+ *
+ * Measures the per-operation cost of the Galois Field primitives in each
+ * arithmetic mode.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "../gf2.h"
+#include "../gf2_region.h"
+
+#define OPERAND_COUNT 4096
+#define REGION_SIZE 65536
+
+volatile int sink;
+
+double now_ns(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+int legacy_mul(int a, int b, GF2_def_struct *gf) {
+	// GF2Mul as it was before the doubled antilog table, kept for comparison.
+	if ((a == 0) | (b == 0)) {
+		return 0;
+	}
+	a = gf->Index[a & gf->Mask];
+	b = gf->Index[b & gf->Mask];
+	a = GF2Mod(a + b, gf);
+	return gf->Table[a & gf->Mask];
+}
+
+double bench_legacy_mul(int *a, int *b, int passes, GF2_def_struct *gf) {
+	int acc = 0;
+	double start = now_ns();
+	for (int p = 0; p < passes; p++) {
+		for (int i = 0; i < OPERAND_COUNT; i++) {
+			acc ^= legacy_mul(a[i], b[i], gf);
+		}
+	}
+	double stop = now_ns();
+	sink = acc;
+	return (stop - start) / ((double)passes * OPERAND_COUNT);
+}
+
+double bench_mul(int *a, int *b, int passes, GF2_def_struct *gf) {
+	int acc = 0;
+	double start = now_ns();
+	for (int p = 0; p < passes; p++) {
+		for (int i = 0; i < OPERAND_COUNT; i++) {
+			acc ^= GF2Mul(a[i], b[i], gf);
+		}
+	}
+	double stop = now_ns();
+	sink = acc;
+	return (stop - start) / ((double)passes * OPERAND_COUNT);
+}
+
+double bench_div(int *a, int *b, int passes, GF2_def_struct *gf) {
+	int acc = 0;
+	double start = now_ns();
+	for (int p = 0; p < passes; p++) {
+		for (int i = 0; i < OPERAND_COUNT; i++) {
+			// divisor is forced nonzero by construction of b[]
+			acc ^= GF2Div(a[i], b[i], gf);
+		}
+	}
+	double stop = now_ns();
+	sink = acc;
+	return (stop - start) / ((double)passes * OPERAND_COUNT);
+}
+
+double bench_muladd_region(uint8_t *dst, uint8_t *src, int passes, GF2_def_struct *gf) {
+	// Returns GB/s of source data processed.
+	double start = now_ns();
+	for (int p = 0; p < passes; p++) {
+		GF2MulAddRegion(dst, src, 1 + (p % (gf->Order - 1)), REGION_SIZE, gf);
+	}
+	double stop = now_ns();
+	sink = dst[passes % REGION_SIZE];
+	return ((double)passes * REGION_SIZE) / (stop - start);
+}
+
+int main(int arg_count, char* arg_values[]) {
+	int gf_poly = 285;
+	int passes = 2000;
+	if (arg_count > 1) {
+		gf_poly = atoi(arg_values[1]);
+	}
+	if (arg_count > 2) {
+		passes = atoi(arg_values[2]);
+	}
+
+	GF2_def_struct *gf = malloc(sizeof(GF2_def_struct));
+	if (InitGF2(gf_poly, gf) != 0) {
+		printf("Galois Field generator polynomial %i is not usable.\r\n", gf_poly);
+		return(-1);
+	}
+
+	int a[OPERAND_COUNT];
+	int b[OPERAND_COUNT];
+	srand(1);
+	for (int i = 0; i < OPERAND_COUNT; i++) {
+		a[i] = rand() & gf->Mask;
+		b[i] = 1 + (rand() % (gf->Order - 1));
+	}
+
+	int fast_available = gf->FastMul;
+	printf("Galois Field %i, %i bits, %i operations per mode.\r\n", gf_poly, gf->Power, passes * OPERAND_COUNT);
+	printf("mode, operation, ns/op\r\n");
+	printf("legacy, mul, %.3f\r\n", bench_legacy_mul(a, b, passes, gf));
+	gf->FastMul = 0;
+	printf("log, mul, %.3f\r\n", bench_mul(a, b, passes, gf));
+	printf("log, div, %.3f\r\n", bench_div(a, b, passes, gf));
+	if (fast_available) {
+		gf->FastMul = 1;
+		printf("table, mul, %.3f\r\n", bench_mul(a, b, passes, gf));
+	}
+	if (fast_available) {
+		const char *kernel_names[] = {"scalar", "ssse3", "avx2"};
+		uint8_t *src = malloc(REGION_SIZE);
+		uint8_t *dst = malloc(REGION_SIZE);
+		for (int i = 0; i < REGION_SIZE; i++) {
+			src[i] = rand() & gf->Mask;
+			dst[i] = 0;
+		}
+		printf("kernel, operation, GB/s\r\n");
+		for (int k = GF2_REGION_SCALAR; k <= GF2_REGION_AVX2; k++) {
+			if (GF2SetRegionKernel(k) == k) {
+				printf("%s, muladd region, %.3f\r\n", kernel_names[k], bench_muladd_region(dst, src, passes / 4 + 1, gf));
+			}
+		}
+		free(src);
+		free(dst);
+	}
+	FreeGF2(gf);
+	free(gf);
+	return 0;
+}
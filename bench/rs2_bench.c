@@ -0,0 +1,575 @@
+/*
+ * File:   rs2_bench.c
+ *
+ * Created on October 17, 2026
+ *
+ * Benchmark suite for the Galois Field primitives and the Reed Solomon codec:
+ * GF2Mul/GF2Div/GF2Conv cost, encode throughput, decode latency percentiles
+ * at each error count, the cost of each decoder stage on its own, and shard
+ * encode and rebuild throughput. Every codec case runs in each arithmetic
+ * mode the code supports:
+ *   log            log/antilog tables only, no code tables
+ *   table/<kernel> product and code tables, with each region kernel
+ *   fixed/<kernel> the specialized codec, when one matches
+ * Results are one row per measurement, as CSV or JSON, for comparing builds.
+ *
+ * gcc -O2 -o bin/rs2-bench bench/rs2_bench.c gf2.c gf2_fft.c gf2_poly.c gf2_region.c rs2.c rs2_fixed.c rs2_pool.c rs2_shard.c rs2_stats.c rng.c -pthread
+ * bin/rs2-bench [-j] [-s <samples>] [-m <milliseconds>]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "../gf2.h"
+#include "../gf2_poly.h"
+#include "../gf2_region.h"
+#include "../rs2.h"
+#include "../rs2_shard.h"
+#include "../rs2_stages.h"
+#include "../rng.h"
+
+#define OPERAND_COUNT 4096
+#define CONV_SIZE 33
+// Operand sizes for the byte polynomial product on the region kernel.
+#define POLY8_SIZE 223
+#define POLY8_FACTOR 32
+#define BATCH_COUNT 1024
+// Shard code measured, over GF 285: data and parity shards, bytes per shard.
+#define SHARD_DATA 10
+#define SHARD_PARITY 4
+#define SHARD_SIZE (64 << 10)
+
+typedef struct {
+	int gen_poly;
+	int first_root;
+	int block_size;
+	int message_size;
+} Bench_code_def_struct;
+
+// Codes to measure. Fields of more than 8 bits take the 16-bit paths.
+const Bench_code_def_struct codes[] = {
+	{285, 0, 255, 223},
+	{285, 0, 255, 239},
+	{285, 1, 255, 191},
+	{285, 0, 15, 13},
+	{1033, 1, 1023, 991},
+};
+
+// One arithmetic mode: a copy of the field and code with some tables removed.
+typedef struct {
+	char name[32];
+	GF2_def_struct gf;
+	RS2_def_struct rs;
+	int kernel;
+} Bench_mode_def_struct;
+
+volatile int sink;
+int json_output = 0;
+int rows_printed = 0;
+double budget_ns = 100e6; // minimum time per throughput measurement
+
+double now_ns(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+void emit(const char *suite, int gen_poly, const char *code, const char *mode, const char *param, const char *metric, double value, const char *unit) {
+	// One result row.
+	if (json_output) {
+		printf("%s\r\n  {\"suite\": \"%s\", \"gf\": %i, \"code\": \"%s\", \"mode\": \"%s\", \"param\": \"%s\", \"metric\": \"%s\", \"value\": %.3f, \"unit\": \"%s\"}",
+			rows_printed ? "," : "[", suite, gen_poly, code, mode, param, metric, value, unit);
+	} else {
+		if (rows_printed == 0) {
+			printf("suite,gf,code,mode,param,metric,value,unit\r\n");
+		}
+		printf("%s,%i,%s,%s,%s,%s,%.3f,%s\r\n", suite, gen_poly, code, mode, param, metric, value, unit);
+	}
+	rows_printed++;
+	fflush(stdout);
+}
+
+int compare_doubles(const void *a, const void *b) {
+	double x = *(const double *)a;
+	double y = *(const double *)b;
+	return (x > y) - (x < y);
+}
+
+double percentile(const double *sorted, int count, double fraction) {
+	int i = (int)(fraction * (count - 1) + 0.5);
+	return sorted[i];
+}
+
+// Builds the modes available for a code: log, table with each kernel the CPU
+// has, and fixed with the best kernel when a specialized codec matches.
+int build_modes(Bench_mode_def_struct *modes, GF2_def_struct *gf, RS2_def_struct *rs) {
+	const char *kernel_names[] = {"scalar", "ssse3", "avx2"};
+	int best = GF2SetRegionKernel(GF2_REGION_AVX2);
+	int count = 0;
+	Bench_mode_def_struct *m = &modes[count++];
+	snprintf(m->name, sizeof(m->name), "log");
+	m->gf = *gf;
+	m->gf.FastMul = 0;
+	m->rs = *rs;
+	m->rs.EncodeTable8 = NULL;
+	m->rs.EncodeTable16 = NULL;
+	m->rs.SyndromeTable8 = NULL;
+	m->rs.MulRootTable16 = NULL;
+	m->rs.Fixed = NULL;
+	m->kernel = GF2_REGION_SCALAR;
+	int kernels = (gf->Power <= 8) ? best : GF2_REGION_SCALAR;
+	for (int k = GF2_REGION_SCALAR; k <= kernels; k++) {
+		m = &modes[count++];
+		if (gf->Power <= 8) {
+			snprintf(m->name, sizeof(m->name), "table/%s", kernel_names[k]);
+		} else {
+			snprintf(m->name, sizeof(m->name), "table");
+		}
+		m->gf = *gf;
+		m->rs = *rs;
+		m->rs.Fixed = NULL;
+		m->kernel = k;
+	}
+	if (rs->Fixed) {
+		m = &modes[count++];
+		snprintf(m->name, sizeof(m->name), "fixed/%s", kernel_names[best]);
+		m->gf = *gf;
+		m->rs = *rs;
+		m->kernel = best;
+	}
+	for (int i = 0; i < count; i++) {
+		modes[i].rs.GF = &modes[i].gf;
+	}
+	return count;
+}
+
+// Sample codewords for one code, in the symbol width its field needs, and a
+// symbol-interleaved batch for the batch encoder and decoder.
+typedef struct {
+	int wide;
+	int block_size;
+	int message_size;
+	int count;
+	uint8_t *blocks8;
+	uint16_t *blocks16;
+	uint8_t *batch;
+} Bench_data_def_struct;
+
+void encode_one(Bench_data_def_struct *d, int i, const RS2_def_struct *rs) {
+	if (d->wide) {
+		RSEncode16(&d->blocks16[(size_t)i * d->block_size], d->message_size, rs);
+	} else {
+		RSEncode8(&d->blocks8[(size_t)i * d->block_size], d->message_size, rs);
+	}
+}
+
+int decode_one(Bench_data_def_struct *d, int i, const RS2_def_struct *rs, RS2_work_struct *ws) {
+	if (d->wide) {
+		return RSDecode16(&d->blocks16[(size_t)i * d->block_size], d->block_size, rs, ws);
+	}
+	return RSDecode8(&d->blocks8[(size_t)i * d->block_size], d->block_size, rs, ws);
+}
+
+// Fills every block with a random message and its parity, then flips the
+// given number of distinct symbols in each.
+void make_blocks(Bench_data_def_struct *d, int errors, const RS2_def_struct *rs, RNG_def_struct *rng) {
+	int bits = rs->GF->Power;
+	uint16_t *symbols = malloc(sizeof(uint16_t) * d->block_size);
+	int *positions = malloc(sizeof(int) * d->block_size);
+	for (int b = 0; b < d->count; b++) {
+		RNGFillSymbols(symbols, d->message_size, bits, rng);
+		for (int j = 0; j < d->message_size; j++) {
+			if (d->wide) {
+				d->blocks16[((size_t)b * d->block_size) + j] = symbols[j];
+			} else {
+				d->blocks8[((size_t)b * d->block_size) + j] = (uint8_t)symbols[j];
+			}
+		}
+		encode_one(d, b, rs);
+		for (int j = 0; j < d->block_size; j++) {
+			positions[j] = j;
+		}
+		for (int e = 0; e < errors; e++) {
+			int pick = e + (int)RNGBounded(d->block_size - e, rng);
+			int position = positions[pick];
+			positions[pick] = positions[e];
+			positions[e] = position;
+			int flip = 1 + (int)RNGBounded(rs->GF->Order - 1, rng);
+			if (d->wide) {
+				d->blocks16[((size_t)b * d->block_size) + position] ^= flip;
+			} else {
+				d->blocks8[((size_t)b * d->block_size) + position] ^= flip;
+			}
+		}
+	}
+	free(symbols);
+	free(positions);
+}
+
+void bench_gf(int gen_poly, RNG_def_struct *rng) {
+	GF2_def_struct gf;
+	if (InitGF2(gen_poly, &gf) != 0) {
+		return;
+	}
+	int a[OPERAND_COUNT];
+	int b[OPERAND_COUNT];
+	for (int i = 0; i < OPERAND_COUNT; i++) {
+		a[i] = RNGBounded(gf.Order, rng);
+		b[i] = 1 + RNGBounded(gf.Order - 1, rng);
+	}
+	int fast_available = gf.FastMul;
+	for (int mode = 0; mode <= fast_available; mode++) {
+		const char *name = mode ? "table" : "log";
+		gf.FastMul = mode;
+		int acc = 0;
+		long ops = 0;
+		double start = now_ns();
+		double elapsed;
+		do {
+			for (int i = 0; i < OPERAND_COUNT; i++) {
+				acc ^= GF2Mul(a[i], b[i], &gf);
+			}
+			ops += OPERAND_COUNT;
+		} while ((elapsed = now_ns() - start) < budget_ns);
+		emit("gf", gen_poly, "-", name, "-", "mul", elapsed / ops, "ns/op");
+		ops = 0;
+		start = now_ns();
+		do {
+			for (int i = 0; i < OPERAND_COUNT; i++) {
+				acc ^= GF2Div(a[i], b[i], &gf);
+			}
+			ops += OPERAND_COUNT;
+		} while ((elapsed = now_ns() - start) < budget_ns);
+		emit("gf", gen_poly, "-", name, "-", "div", elapsed / ops, "ns/op");
+		// Product of two polynomials of 17 coefficients, into a buffer of 33.
+		int half = (CONV_SIZE + 1) / 2;
+		int p1[CONV_SIZE];
+		int p2[(CONV_SIZE + 1) / 2];
+		ops = 0;
+		start = now_ns();
+		do {
+			for (int i = 0; i < half; i++) {
+				p1[i] = a[(ops + i) % OPERAND_COUNT];
+				p2[i] = b[(ops + i) % OPERAND_COUNT];
+			}
+			GF2Conv(p1, half, p2, half, &gf);
+			acc ^= p1[half];
+			ops++;
+		} while ((elapsed = now_ns() - start) < budget_ns);
+		emit("gf", gen_poly, "-", name, "17x17", "conv", elapsed / ops, "ns/op");
+		sink = acc;
+	}
+	gf.FastMul = fast_available;
+	// The same product on GF2PolyMul, in place, which works on logs whatever
+	// the mode.
+	int half = (CONV_SIZE + 1) / 2;
+	GF2_elem_t q1[CONV_SIZE];
+	GF2_elem_t q2[(CONV_SIZE + 1) / 2];
+	long ops = 0;
+	double start = now_ns();
+	double elapsed;
+	do {
+		for (int i = 0; i < half; i++) {
+			q1[i] = a[(ops + i) % OPERAND_COUNT];
+			q2[i] = b[(ops + i) % OPERAND_COUNT];
+		}
+		GF2PolyMul(q1, q1, half, q2, half, &gf);
+		sink ^= q1[half];
+		ops++;
+	} while ((elapsed = now_ns() - start) < budget_ns);
+	emit("gf", gen_poly, "-", "log", "17x17", "polymul", elapsed / ops, "ns/op");
+	if (fast_available) {
+		uint8_t r8[POLY8_SIZE + POLY8_FACTOR - 1];
+		uint8_t p8[POLY8_SIZE];
+		uint8_t f8[POLY8_FACTOR];
+		for (int i = 0; i < POLY8_SIZE; i++) {
+			p8[i] = a[i];
+		}
+		for (int i = 0; i < POLY8_FACTOR; i++) {
+			f8[i] = b[i];
+		}
+		ops = 0;
+		start = now_ns();
+		do {
+			GF2PolyMul8(r8, p8, POLY8_SIZE, f8, POLY8_FACTOR, &gf);
+			p8[ops % POLY8_SIZE] ^= r8[POLY8_SIZE];
+			ops++;
+		} while ((elapsed = now_ns() - start) < budget_ns);
+		emit("gf", gen_poly, "-", "region", "223x32", "polymul8", elapsed / ops, "ns/op");
+	}
+	FreeGF2(&gf);
+}
+
+void bench_encode(Bench_data_def_struct *d, const Bench_mode_def_struct *m, const char *code) {
+	// Message bytes, at the symbol width in memory, per second.
+	size_t symbol_bytes = d->wide ? sizeof(uint16_t) : 1;
+	long codewords = 0;
+	double start = now_ns();
+	double elapsed;
+	do {
+		for (int i = 0; i < d->count; i++) {
+			encode_one(d, i, &m->rs);
+		}
+		codewords += d->count;
+	} while ((elapsed = now_ns() - start) < budget_ns);
+	emit("encode", m->rs.GF->GenPoly, code, m->name, "single", "throughput", (codewords * d->message_size * symbol_bytes * 1e3) / elapsed, "MB/s");
+	if (d->wide || (d->batch == NULL) || (m->rs.GF->FastMul == 0)) {
+		return;
+	}
+	codewords = 0;
+	start = now_ns();
+	do {
+		RSEncodeBatch8(d->batch, BATCH_COUNT, d->message_size, &m->rs);
+		codewords += BATCH_COUNT;
+	} while ((elapsed = now_ns() - start) < budget_ns);
+	emit("encode", m->rs.GF->GenPoly, code, m->name, "batch", "throughput", (codewords * d->message_size * 1e3) / elapsed, "MB/s");
+	// Clean codewords through the batch decoder: the syndrome pass alone.
+	int *results = malloc(sizeof(int) * BATCH_COUNT);
+	RS2_work_struct ws;
+	if ((results != NULL) && (InitRS2Work(&m->rs, &ws) == 0)) {
+		codewords = 0;
+		start = now_ns();
+		do {
+			RSDecodeBatch8(d->batch, BATCH_COUNT, d->block_size, results, &m->rs, &ws);
+			codewords += BATCH_COUNT;
+		} while ((elapsed = now_ns() - start) < budget_ns);
+		emit("decode", m->rs.GF->GenPoly, code, m->name, "batch e=0", "throughput", (codewords * d->block_size * 1e3) / elapsed, "MB/s");
+		FreeRS2Work(&ws);
+	}
+	free(results);
+}
+
+void bench_decode(Bench_data_def_struct *d, const Bench_mode_def_struct *m, const char *code, RNG_def_struct *rng) {
+	// Latency of single decodes, one timing per sample, at each error count
+	// up to the correction limit.
+	RS2_work_struct ws;
+	double *times = malloc(sizeof(double) * d->count);
+	if ((times == NULL) || (InitRS2Work(&m->rs, &ws) < 0)) {
+		free(times);
+		return;
+	}
+	int limit = m->rs.NumRoots / 2;
+	char param[32];
+	for (int errors = 0; errors <= limit; errors++) {
+		make_blocks(d, errors, &m->rs, rng);
+		int failures = 0;
+		double total = 0;
+		for (int i = 0; i < d->count; i++) {
+			double start = now_ns();
+			int result = decode_one(d, i, &m->rs, &ws);
+			times[i] = now_ns() - start;
+			total += times[i];
+			failures += (result != errors);
+		}
+		qsort(times, d->count, sizeof(double), compare_doubles);
+		snprintf(param, sizeof(param), "e=%i", errors);
+		emit("decode", m->rs.GF->GenPoly, code, m->name, param, "mean", total / d->count, "ns");
+		emit("decode", m->rs.GF->GenPoly, code, m->name, param, "p50", percentile(times, d->count, 0.5), "ns");
+		emit("decode", m->rs.GF->GenPoly, code, m->name, param, "p90", percentile(times, d->count, 0.9), "ns");
+		emit("decode", m->rs.GF->GenPoly, code, m->name, param, "p99", percentile(times, d->count, 0.99), "ns");
+		emit("decode", m->rs.GF->GenPoly, code, m->name, param, "max", times[d->count - 1], "ns");
+		if (failures) {
+			emit("decode", m->rs.GF->GenPoly, code, m->name, param, "failures", failures, "count");
+		}
+	}
+	FreeRS2Work(&ws);
+	free(times);
+}
+
+// Runs one stage repeatedly on the same decoder state.
+#define BENCH_STAGE(stage, setup, call) do { \
+	long calls = 0; \
+	double start = now_ns(); \
+	double elapsed; \
+	do { \
+		setup; \
+		call; \
+		calls++; \
+	} while ((elapsed = now_ns() - start) < budget_ns); \
+	emit("stage", m->rs.GF->GenPoly, code, m->name, param, stage, elapsed / calls, "ns"); \
+} while (0)
+
+void bench_stages(Bench_data_def_struct *d, const Bench_mode_def_struct *m, const char *code, RNG_def_struct *rng) {
+	// Each stage in isolation, on one block with 1, t/2 and t errors. The
+	// verify stage restores the syndromes it consumes on every call.
+	RS2_work_struct ws;
+	if (InitRS2Work(&m->rs, &ws) < 0) {
+		return;
+	}
+	int limit = m->rs.NumRoots / 2;
+	int counts[3] = {1, limit / 2, limit};
+	char param[32];
+	for (int c = 0; c < 3; c++) {
+		int errors = counts[c];
+		if ((errors < 1) || ((c > 0) && (errors == counts[c - 1]))) {
+			continue;
+		}
+		make_blocks(d, errors, &m->rs, rng);
+		snprintf(param, sizeof(param), "e=%i", errors);
+		set_erasures(d->block_size, NULL, 0, &m->rs, &ws);
+		if (d->wide) {
+			BENCH_STAGE("syndromes", (void)0, sink = calc_syndromes16(&m->rs, &ws, d->blocks16));
+		} else {
+			BENCH_STAGE("syndromes", (void)0, sink = calc_syndromes8(&m->rs, &ws, d->blocks8));
+		}
+		BENCH_STAGE("berlekamp", (void)0, calc_berlekamp2(&m->rs, &ws));
+		BENCH_STAGE("chien", (void)0, sink = calc_chien(&m->rs, &ws));
+		BENCH_STAGE("forney", (void)0, calc_forney(&m->rs, &ws));
+		save_syndromes(&m->rs, &ws);
+		BENCH_STAGE("verify", memcpy(ws.Syndromes, ws.SavedSyndromes, sizeof(GF2_elem_t) * m->rs.NumRoots), sink = update_syndromes(&m->rs, &ws));
+	}
+	FreeRS2Work(&ws);
+}
+
+void bench_shards(RNG_def_struct *rng) {
+	// Data bytes per second through encode, and through a rebuild of
+	// SHARD_PARITY lost data shards with the decode matrix cached, on each
+	// region kernel.
+	const char *kernel_names[] = {"scalar", "ssse3", "avx2"};
+	GF2_def_struct gf;
+	RS2_def_struct rs;
+	RS2_shard_struct sh;
+	RS2_shard_work_struct sw;
+	if (InitGF2(285, &gf) != 0) {
+		return;
+	}
+	rs.GF = &gf;
+	if (InitRS2(0, SHARD_PARITY, &rs) < 0) {
+		FreeGF2(&gf);
+		return;
+	}
+	if ((InitRS2Shards(SHARD_DATA, &rs, &sh) < 0) || (InitRS2ShardWork(&sh, &sw) < 0)) {
+		FreeRS2Shards(&sh);
+		FreeRS2(&rs);
+		FreeGF2(&gf);
+		return;
+	}
+	uint8_t *memory = malloc((size_t)(SHARD_DATA + SHARD_PARITY) * SHARD_SIZE);
+	uint8_t *shards[SHARD_DATA + SHARD_PARITY];
+	int present[SHARD_DATA + SHARD_PARITY];
+	if (memory != NULL) {
+		for (int i = 0; i < SHARD_DATA + SHARD_PARITY; i++) {
+			shards[i] = &memory[(size_t)i * SHARD_SIZE];
+			present[i] = (i >= SHARD_PARITY);
+		}
+		for (int i = 0; i < SHARD_DATA * SHARD_SIZE; i++) {
+			memory[i] = (uint8_t)RNGBounded(256, rng);
+		}
+		char code[32];
+		snprintf(code, sizeof(code), "%i+%i", SHARD_DATA, SHARD_PARITY);
+		int best = GF2SetRegionKernel(GF2_REGION_AVX2);
+		for (int k = GF2_REGION_SCALAR; k <= best; k++) {
+			GF2SetRegionKernel(k);
+			long passes = 0;
+			double start = now_ns();
+			double elapsed;
+			do {
+				RSEncodeShards(shards, SHARD_SIZE, &sh);
+				passes++;
+			} while ((elapsed = now_ns() - start) < budget_ns);
+			emit("shard", 285, code, kernel_names[k], "encode", "throughput", (passes * SHARD_DATA * (double)SHARD_SIZE * 1e3) / elapsed, "MB/s");
+			passes = 0;
+			start = now_ns();
+			do {
+				RSRebuildShards(shards, present, SHARD_SIZE, &sh, &sw);
+				passes++;
+			} while ((elapsed = now_ns() - start) < budget_ns);
+			emit("shard", 285, code, kernel_names[k], "rebuild", "throughput", (passes * SHARD_DATA * (double)SHARD_SIZE * 1e3) / elapsed, "MB/s");
+		}
+		GF2SetRegionKernel(GF2_REGION_AVX2);
+	}
+	free(memory);
+	FreeRS2ShardWork(&sw);
+	FreeRS2Shards(&sh);
+	FreeRS2(&rs);
+	FreeGF2(&gf);
+}
+
+int main(int arg_count, char* arg_values[]) {
+	int samples = 500;
+	for (int i = 1; i < arg_count; i++) {
+		if (strcmp(arg_values[i], "-j") == 0) {
+			json_output = 1;
+		} else if ((strcmp(arg_values[i], "-s") == 0) && (i + 1 < arg_count)) {
+			samples = atoi(arg_values[++i]);
+		} else if ((strcmp(arg_values[i], "-m") == 0) && (i + 1 < arg_count)) {
+			budget_ns = atof(arg_values[++i]) * 1e6;
+		} else {
+			printf("Usage: rs2-bench [-j] [-s <samples>] [-m <milliseconds>]\r\n");
+			printf("  -j  JSON output instead of CSV\r\n");
+			printf("  -s  decode latency samples per error count, default 500\r\n");
+			printf("  -m  minimum time per throughput measurement, default 100\r\n");
+			return(-1);
+		}
+	}
+	if (samples < 1) {
+		samples = 1;
+	}
+	int code_count = (int)(sizeof(codes) / sizeof(codes[0]));
+	RNG_def_struct rng;
+	RNGSeed(1, &rng);
+
+	// Field primitives, once per field.
+	for (int c = 0; c < code_count; c++) {
+		int seen = 0;
+		for (int p = 0; p < c; p++) {
+			seen |= (codes[p].gen_poly == codes[c].gen_poly);
+		}
+		if (!seen) {
+			bench_gf(codes[c].gen_poly, &rng);
+		}
+	}
+
+	for (int c = 0; c < code_count; c++) {
+		const Bench_code_def_struct *bc = &codes[c];
+		GF2_def_struct gf;
+		RS2_def_struct rs;
+		if (InitGF2(bc->gen_poly, &gf) != 0) {
+			continue;
+		}
+		rs.GF = &gf;
+		if (InitRS2(bc->first_root, bc->block_size - bc->message_size, &rs) < 0) {
+			FreeGF2(&gf);
+			continue;
+		}
+		char code[32];
+		snprintf(code, sizeof(code), "%i/%i r%i", bc->block_size, bc->message_size, bc->first_root);
+		Bench_data_def_struct d;
+		d.wide = (gf.Power > 8);
+		d.block_size = bc->block_size;
+		d.message_size = bc->message_size;
+		d.count = samples;
+		d.blocks8 = d.wide ? NULL : malloc((size_t)samples * bc->block_size);
+		d.blocks16 = d.wide ? malloc(sizeof(uint16_t) * samples * bc->block_size) : NULL;
+		d.batch = d.wide ? NULL : malloc((size_t)BATCH_COUNT * bc->block_size);
+		if (d.batch) {
+			for (int i = 0; i < BATCH_COUNT * bc->block_size; i++) {
+				d.batch[i] = (uint8_t)RNGBounded(gf.Order, &rng);
+			}
+			RSEncodeBatch8(d.batch, BATCH_COUNT, bc->message_size, &rs);
+		}
+		if ((d.blocks8 != NULL) || (d.blocks16 != NULL)) {
+			Bench_mode_def_struct modes[8];
+			int mode_count = build_modes(modes, &gf, &rs);
+			for (int i = 0; i < mode_count; i++) {
+				GF2SetRegionKernel(modes[i].kernel);
+				make_blocks(&d, 0, &modes[i].rs, &rng);
+				bench_encode(&d, &modes[i], code);
+				bench_decode(&d, &modes[i], code, &rng);
+				bench_stages(&d, &modes[i], code, &rng);
+			}
+			GF2SetRegionKernel(GF2_REGION_AVX2);
+		}
+		free(d.blocks8);
+		free(d.blocks16);
+		free(d.batch);
+		FreeRS2(&rs);
+		FreeGF2(&gf);
+	}
+	bench_shards(&rng);
+	if (json_output) {
+		printf("%s\r\n]\r\n", rows_printed ? "" : "[");
+	}
+	return 0;
+}
@@ -1,3 +1,5 @@
+#include <stdlib.h>
+#include <pthread.h>
 #include "gf2.h"
 
 void lfsr_step(GF2_def_struct *gf) {
@@ -15,7 +17,7 @@ int GF2GetOrder(GF2_def_struct *gf) {
 }
 
 int GF2Pow(int i, GF2_def_struct *gf) {
-    return gf->Table[i & gf->Mask];
+    return gf->Table[i];
 }
 
 int GF2Log(int i, GF2_def_struct *gf) {
@@ -27,12 +29,10 @@ int GF2Inv(int i, GF2_def_struct *gf) {
 }
 
 int GF2Mod(int i, GF2_def_struct *gf) {
-	while (i < 0) {
+	i %= (gf->Order - 1);
+	if (i < 0) {
 		i += (gf->Order - 1);
 	}
-	while (i > (gf->Order - 2)) {
-		i -= (gf->Order - 1);
-	}
 	return i;
 }
 
@@ -43,7 +43,20 @@ int GF2Clamp(int i, GF2_def_struct *gf) {
 	return i;
 }
 
-int InitGF2(int genpoly, GF2_def_struct *gf) {
+// Process-wide cache of maximal fields, keyed by generator polynomial.
+// Entries own their tables until exit.
+GF2_def_struct gf2_cache[GF2_CACHE_SIZE];
+int gf2_cache_count = 0;
+pthread_mutex_t gf2_cache_lock = PTHREAD_MUTEX_INITIALIZER;
+
+int build_gf2(int genpoly, GF2_def_struct *gf) {
+	gf->Cached = 0;
+	gf->Table = NULL;
+	gf->Index = NULL;
+	gf->Inverse = NULL;
+	gf->MulTable = NULL;
+	gf->NibbleTable = NULL;
+	gf->FastMul = 0;
 	if (!(genpoly & 1)) {
 		// Generator polynomial must be odd.
 		return(-1);
@@ -56,12 +69,23 @@ int InitGF2(int genpoly, GF2_def_struct *gf) {
 		gf->Power++;
 	}
 	gf->Mask = gf->Order - 1;
+	if ((gf->Power < 1) || (gf->Power > MAX_GF_BITS)) {
+		return(-2);
+	}
+	gf->Table = calloc(2 * (gf->Order - 1), sizeof(GF2_elem_t));
+	gf->Index = calloc(gf->Order, sizeof(GF2_elem_t));
+	gf->Inverse = calloc(gf->Order, sizeof(GF2_elem_t));
+	if ((gf->Table == NULL) || (gf->Index == NULL) || (gf->Inverse == NULL)) {
+		FreeGF2(gf);
+		return(-2);
+	}
     // generate the field table and index
     int status = 0;
     gf->LFSR = 1; // start with GF element a^0
     for (int i = gf->Order - 2; i >= 0; i--) {
         lfsr_step(gf);
         gf->Table[i & gf->Mask] = gf->LFSR;
+        gf->Table[(i & gf->Mask) + gf->Order - 1] = gf->LFSR;
         gf->Index[gf->LFSR & gf->Mask] = i;
         if ((gf->LFSR == 1) && (i > 0)) {
             status++; // number of times sequence repeated during generation
@@ -69,27 +93,82 @@ int InitGF2(int genpoly, GF2_def_struct *gf) {
     }
     if (status == 0) {
 	    gf->Index[0] = 0;
-	    // generate the inverse table
+	    // generate the inverse table, 1/a^i = a^(Order - 1 - i)
 	    gf->Inverse[0] = 0;
 	    for (int i = 1; i < gf->Order; i++) {
-	        int j = 1;
-	        while (GF2Mul(i, j, gf) != 1) {
-	            j++;
+	        gf->Inverse[i] = gf->Table[(gf->Order - 1) - gf->Index[i]];
+	    }
+	    // generate the product table for small fields
+	    if (gf->Power <= GF2_FAST_MUL_BITS) {
+	        gf->MulTable = malloc((size_t)gf->Order * gf->Order);
+	        gf->NibbleTable = malloc((size_t)gf->Order * 32);
+	    }
+	    if (gf->MulTable && gf->NibbleTable) {
+	        for (int a = 0; a < gf->Order; a++) {
+	            for (int b = 0; b < gf->Order; b++) {
+	                gf->MulTable[(a << gf->Power) | b] = GF2Mul(a, b, gf);
+	            }
 	        }
-	        gf->Inverse[i] = j;
+	        // split-nibble tables, zero where the shifted nibble is not an element
+	        for (int c = 0; c < gf->Order; c++) {
+	            for (int n = 0; n < 16; n++) {
+	                gf->NibbleTable[(c * 32) + n] = (n < gf->Order) ? GF2Mul(c, n, gf) : 0;
+	                gf->NibbleTable[(c * 32) + 16 + n] = ((n << 4) < gf->Order) ? GF2Mul(c, n << 4, gf) : 0;
+	            }
+	        }
+	        gf->FastMul = 1;
 	    }
 	}
     return status;
 }
 
+int InitGF2(int genpoly, GF2_def_struct *gf) {
+	// Reuse a field built earlier. Building under the lock keeps racing
+	// threads from building the same field twice.
+	pthread_mutex_lock(&gf2_cache_lock);
+	for (int i = 0; i < gf2_cache_count; i++) {
+		if (gf2_cache[i].GenPoly == genpoly) {
+			*gf = gf2_cache[i];
+			pthread_mutex_unlock(&gf2_cache_lock);
+			return 0;
+		}
+	}
+	gf->Cached = 0;
+	int status = build_gf2(genpoly, gf);
+	if ((status == 0) && (gf2_cache_count < GF2_CACHE_SIZE)) {
+		gf->Cached = 1;
+		gf2_cache[gf2_cache_count++] = *gf;
+	}
+	pthread_mutex_unlock(&gf2_cache_lock);
+	return status;
+}
+
+void FreeGF2(GF2_def_struct *gf) {
+	// Tables shared with the cache stay allocated.
+	if (!gf->Cached) {
+		free(gf->Table);
+		free(gf->Index);
+		free(gf->Inverse);
+		free(gf->MulTable);
+		free(gf->NibbleTable);
+	}
+	gf->Table = NULL;
+	gf->Index = NULL;
+	gf->Inverse = NULL;
+	gf->MulTable = NULL;
+	gf->NibbleTable = NULL;
+	gf->FastMul = 0;
+}
+
 int GF2Mul(int a, int b, GF2_def_struct *gf) {
+	if (gf->FastMul) {
+		return gf->MulTable[((a & gf->Mask) << gf->Power) | (b & gf->Mask)];
+	}
 	if ((a == 0) | (b == 0)) {
 		return 0;
 	}
-	a = gf->Index[a & gf->Mask];
-	b = gf->Index[b & gf->Mask];
-	a = GF2Mod(a + b, gf);
-	return gf->Table[a & gf->Mask];
+	// Sum of logs is at most 2 * (Order - 2), inside the doubled table.
+	return gf->Table[gf->Index[a & gf->Mask] + gf->Index[b & gf->Mask]];
 }
 
 int GF2Div(int a_arg, int b_arg, GF2_def_struct *gf) {
@@ -101,10 +180,8 @@ int GF2Div(int a_arg, int b_arg, GF2_def_struct *gf) {
 	if (a == 0) {
 		return 0;
 	}
-	a = gf->Index[a & gf->Mask];
-	b = gf->Index[b & gf->Mask];
-	a = GF2Mod(a - b, gf);
-	return gf->Table[a & gf->Mask];
+	// Offset by Order - 1 so the difference of logs is never negative.
+	return gf->Table[gf->Index[a & gf->Mask] + (gf->Order - 1) - gf->Index[b & gf->Mask]];
 }
 
 int GF2Conv(int *p1, int p1n, int *p2, int p2n, GF2_def_struct *gf) {
@@ -115,18 +192,17 @@ int GF2Conv(int *p1, int p1n, int *p2, int p2n, GF2_def_struct *gf) {
 // returns p1n + p2n - 1
 // places result in p1
 // p1 must have length p1n + p2n - 1
+// Coefficient k only reads p1[0..k], so the result is built from the top
+// down straight into p1.
 	int k = p1n + p2n - 1;
-	int pr[k];
-	for (int i = 0; i < k; i++) {
-		pr[i] = 0;
-	}
-	for (int i = 0; i < p1n; i++) {
-		for (int j = 0; j < p2n; j++) {
-			pr[i + j] = pr[i + j] ^ GF2Mul(p1[i], p2[j], gf);
+	for (int n = k - 1; n >= 0; n--) {
+		int lo = (n - p2n + 1 > 0) ? n - p2n + 1 : 0;
+		int hi = (n < p1n - 1) ? n : p1n - 1;
+		int sum = 0;
+		for (int i = lo; i <= hi; i++) {
+			sum ^= GF2Mul(p1[i], p2[n - i], gf);
 		}
-	}
-	for (int i = 0; i < k; i++) {
-		p1[i] = pr[i];
+		p1[n] = sum;
 	}
 	return k;
 }
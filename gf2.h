@@ -15,14 +15,24 @@
 // Arg1: Power of base-2 field, ie 2^Power. 2^8 for 8-bit field.
 // Arg2: Generator (reducing) polynomial, in binary. 285 = x^8+x^4+x^3+x^2+1
 // Returns 0 for maximal field, number of repetition cycles otherwise.
+// Returns -1 if the polynomial is even, -2 if the field is larger than
+// MAX_GF_BITS or its tables could not be allocated.
+// Allocates the field tables; call FreeGF2 when done, whatever the result.
+// Maximal fields are cached process-wide, so initializing the same field
+// again is nearly free. Thread safe.
 int InitGF2(int, GF2_def_struct*);
 
+// FreeGF2
+// Releases memory allocated by InitGF2.
+void FreeGF2(GF2_def_struct*);
+
 // GF2GetOrder
 // Returns order (size) of specified field.
 int GF2GetOrder(GF2_def_struct*);
 
 // GF2Mul
-// Performs Galois Field multiplication by addition of exponents.
+// Performs Galois Field multiplication by addition of exponents, or by a
+// single product table lookup for fields up to GF2_FAST_MUL_BITS.
 // Arg1: multiplicand
 // Arg2: multiplier
 // Returns product.
@@ -46,6 +56,7 @@ int GF2Conv(int*, int, int*, int, GF2_def_struct*);
 
 // GF2Pow
 // Returns field primitive (2) raised to Arg.
+// Arg must be in the range 0 to 2 * (Order - 1) - 1.
 int GF2Pow(int, GF2_def_struct*);
 
 // GF2Log
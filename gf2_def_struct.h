@@ -8,23 +8,70 @@
 #ifndef GF2_DEF_STRUCT_H
 #define	GF2_DEF_STRUCT_H
 
-// Change to suit your application. Bigger = more memory used!
-#define MAX_GF_BITS 10
+#include <stdint.h>
+
+// Largest field supported, GF(2^16). Tables are allocated by InitGF2 to
+// the size of the field actually used, so this costs nothing for small
+// fields.
+#define MAX_GF_BITS 16
+
+// Fields with at most this many bits get a full Order x Order product table,
+// so GF2Mul becomes a single lookup. 8 bits costs 64 KB. Set to 0 to disable.
+// Maximum is 8, since products are stored as bytes.
+#define GF2_FAST_MUL_BITS 8
+
+// Fields kept by InitGF2's process-wide cache. Further fields are built and
+// freed as before.
+#define GF2_CACHE_SIZE 8
 
 // Don't change below this line.
-// MAX_FIELD_SIZE controls how much memory is allocated for tables.
 #define MAX_FIELD_SIZE (1 << MAX_GF_BITS)
 
+#if GF2_FAST_MUL_BITS > 8
+#error "GF2_FAST_MUL_BITS must not exceed 8"
+#endif
+
+// Smallest type that holds one field element (or one log).
+#if MAX_GF_BITS <= 8
+typedef uint8_t GF2_elem_t;
+#else
+typedef uint16_t GF2_elem_t;
+#endif
+
 typedef struct {
-    int Table[MAX_FIELD_SIZE - 1];
-    int Index[MAX_FIELD_SIZE];
-    int Inverse[MAX_FIELD_SIZE];
+    // Antilog table, stored twice over so that the sum or difference of two
+    // logs indexes it directly without modular reduction. 2 * (Order - 1)
+    // entries; Index and Inverse hold Order entries.
+    GF2_elem_t *Table;
+    GF2_elem_t *Index;
+    GF2_elem_t *Inverse;
+    // Product table, MulTable[(a << Power) | b] = a * b. Order * Order bytes,
+    // allocated and valid only when FastMul is set.
+    unsigned char *MulTable;
+    // Split-nibble product tables for the region kernels, 32 bytes per constant
+    // c: c * (0..15) followed by c * ((0..15) << 4). Valid when FastMul set.
+    unsigned char *NibbleTable;
     int Power;
     int GenPoly;
     int Order;
     int LFSR;
     int Mask;
+    int FastMul;
+    int Cached; // tables belong to the field cache, FreeGF2 leaves them
 } GF2_def_struct;
 
+// Additive FFT plan, built by InitGF2FFT. Evaluates a polynomial at every
+// element of the field, on the basis 1, 2, 4, ... so the value at element x
+// lands at index x. Level l works on blocks of 2^l coefficients.
+typedef struct {
+    // Log of the basis element each level scales by, Power + 1 entries,
+    // indexed by level.
+    int *BetaLog;
+    // Subspace elements added in at each level, 2^(l - 1) of them for level
+    // l, starting at index 2^(l - 1) - 1. Order - 1 entries in all.
+    GF2_elem_t *Twiddle;
+    int Power;
+} GF2_fft_struct;
+
 #endif	/* GF2_DEF_STRUCT_H */
 
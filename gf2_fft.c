@@ -0,0 +1,119 @@
+#include <stdlib.h>
+#include <string.h>
+#include "gf2_fft.h"
+#include "gf2.h"
+
+int InitGF2FFT(GF2_def_struct *gf, GF2_fft_struct *fft) {
+	int m = gf->Power;
+	fft->Power = m;
+	fft->BetaLog = malloc(sizeof(int) * (m + 1));
+	fft->Twiddle = malloc(sizeof(GF2_elem_t) * (gf->Order - 1));
+	if ((fft->BetaLog == NULL) || (fft->Twiddle == NULL)) {
+		FreeGF2FFT(fft);
+		return -1;
+	}
+	// Level l evaluates on the span of basis[0..l-1], scaled so its top
+	// element is 1: gamma_j = basis[j] / basis[l - 1]. The halves of the
+	// Taylor expansion are then evaluated on the span of the images
+	// gamma_j^2 + gamma_j, the basis of level l - 1.
+	int basis[MAX_GF_BITS];
+	int gamma[MAX_GF_BITS];
+	for (int j = 0; j < m; j++) {
+		basis[j] = 1 << j;
+	}
+	fft->BetaLog[0] = 0;
+	for (int l = m; l >= 1; l--) {
+		int beta = basis[l - 1];
+		fft->BetaLog[l] = GF2Log(beta, gf);
+		for (int j = 0; j < l - 1; j++) {
+			gamma[j] = GF2Div(basis[j], beta, gf);
+		}
+		GF2_elem_t *twiddle = &fft->Twiddle[(1 << (l - 1)) - 1];
+		twiddle[0] = 0;
+		for (int i = 1; i < (1 << (l - 1)); i++) {
+			// Add the basis element of the lowest set bit to the span
+			// element without it.
+			int j = 0;
+			while (((i >> j) & 1) == 0) {
+				j++;
+			}
+			twiddle[i] = twiddle[i & (i - 1)] ^ gamma[j];
+		}
+		for (int j = 0; j < l - 1; j++) {
+			basis[j] = GF2Mul(gamma[j], gamma[j], gf) ^ gamma[j];
+		}
+	}
+	return 0;
+}
+
+void FreeGF2FFT(GF2_fft_struct *fft) {
+	free(fft->BetaLog);
+	free(fft->Twiddle);
+	fft->BetaLog = NULL;
+	fft->Twiddle = NULL;
+}
+
+void taylor_expand(GF2_elem_t *f, int n) {
+	// Rewrites f, n a power of two, as sum h_i(x) (x^2 + x)^i with each h_i
+	// linear, h_i at f[2i] and f[2i + 1]. With tau = n / 4, dividing by
+	// (x^2 + x)^tau = x^(2 tau) + x^tau splits f into halves that expand
+	// separately, and the division is two passes of adds.
+	if (n <= 2) {
+		return;
+	}
+	int tau = n / 4;
+	for (int i = 0; i < tau; i++) {
+		f[(2 * tau) + i] ^= f[(3 * tau) + i];
+		f[tau + i] ^= f[(2 * tau) + i];
+	}
+	taylor_expand(f, n / 2);
+	taylor_expand(&f[n / 2], n / 2);
+}
+
+void fft_level(const GF2_fft_struct *fft, GF2_elem_t *f, GF2_elem_t *scratch, int level, GF2_def_struct *gf) {
+	if (level == 0) {
+		return;
+	}
+	const GF2_elem_t *table = gf->Table;
+	const GF2_elem_t *index = gf->Index;
+	int period = gf->Order - 1;
+	int size = 1 << level;
+	int half = size / 2;
+	// f(beta x), so the top basis element of this level becomes 1.
+	int beta_log = fft->BetaLog[level];
+	int power_log = 0;
+	for (int i = 1; i < size; i++) {
+		power_log += beta_log;
+		if (power_log >= period) {
+			power_log -= period;
+		}
+		if (f[i]) {
+			f[i] = table[index[f[i]] + power_log];
+		}
+	}
+	// f = g0(x^2 + x) + x g1(x^2 + x); g0 to the low half, g1 to the high.
+	taylor_expand(f, size);
+	for (int i = 0; i < half; i++) {
+		scratch[i] = f[2 * i];
+		scratch[half + i] = f[(2 * i) + 1];
+	}
+	memcpy(f, scratch, sizeof(GF2_elem_t) * size);
+	fft_level(fft, f, scratch, level - 1, gf);
+	fft_level(fft, &f[half], scratch, level - 1, gf);
+	// At a point x of the span and at x + 1, x^2 + x is the same point of
+	// the next level's span, so f(x) = g0 + x g1 and f(x + 1) = f(x) + g1.
+	const GF2_elem_t *twiddle = &fft->Twiddle[half - 1];
+	for (int i = 0; i < half; i++) {
+		int g1 = f[half + i];
+		int value = f[i];
+		if (g1 && twiddle[i]) {
+			value ^= table[index[g1] + index[twiddle[i]]];
+		}
+		f[i] = value;
+		f[half + i] = value ^ g1;
+	}
+}
+
+void GF2FFT(const GF2_fft_struct *fft, GF2_elem_t *f, GF2_elem_t *scratch, GF2_def_struct *gf) {
+	fft_level(fft, f, scratch, fft->Power, gf);
+}
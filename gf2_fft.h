@@ -0,0 +1,32 @@
+/*
+ * File:   gf2_fft.h
+ *
+ * Created on October 17, 2026
+ */
+
+#ifndef GF2_FFT_H
+#define	GF2_FFT_H
+
+#include "gf2_def_struct.h"
+
+// InitGF2FFT
+// Builds the additive FFT plan for a field, following Gao and Mateer: each
+// level scales the polynomial, splits it by a Taylor expansion at x^2 + x,
+// and evaluates the two halves on a subspace of half the size. The cost is
+// about 3 / 2 * Order * Power multiplies and Order * Power^2 / 4 adds,
+// against Order * degree multiplies for direct evaluation at every element.
+// Returns 0 on success, -1 if memory could not be allocated.
+int InitGF2FFT(GF2_def_struct*, GF2_fft_struct*);
+
+// FreeGF2FFT
+// Releases memory allocated by InitGF2FFT.
+void FreeGF2FFT(GF2_fft_struct*);
+
+// GF2FFT
+// Evaluates a polynomial at every element of the field, in place.
+// Arg2: pointer to Order coefficients, lowest power first, zero filled past
+//       the degree. Replaced by the values: entry x holds the value at x.
+// Arg3: pointer to scratch, Order symbols
+void GF2FFT(const GF2_fft_struct*, GF2_elem_t*, GF2_elem_t*, GF2_def_struct*);
+
+#endif	/* GF2_FFT_H */
@@ -0,0 +1,107 @@
+#include <string.h>
+#include "gf2_poly.h"
+#include "gf2_region.h"
+
+int GF2PolyMulTrunc(GF2_elem_t *r, const GF2_elem_t *p1, int p1n, const GF2_elem_t *p2, int p2n, int n, GF2_def_struct *gf) {
+	// Coefficient k only reads p1[0..k], so going from the top down lets the
+	// result overwrite p1 without a copy.
+	const GF2_elem_t *table = gf->Table;
+	const GF2_elem_t *index = gf->Index;
+	for (int k = n - 1; k >= 0; k--) {
+		int lo = (k - p2n + 1 > 0) ? k - p2n + 1 : 0;
+		int hi = (k < p1n - 1) ? k : p1n - 1;
+		int sum = 0;
+		for (int i = lo; i <= hi; i++) {
+			if (p1[i] && p2[k - i]) {
+				// Sum of logs is at most 2 * (Order - 2), inside the doubled table.
+				sum ^= table[index[p1[i]] + index[p2[k - i]]];
+			}
+		}
+		r[k] = sum;
+	}
+	return n;
+}
+
+int GF2PolyMul(GF2_elem_t *r, const GF2_elem_t *p1, int p1n, const GF2_elem_t *p2, int p2n, GF2_def_struct *gf) {
+	if ((p1n <= 0) || (p2n <= 0)) {
+		return 0;
+	}
+	return GF2PolyMulTrunc(r, p1, p1n, p2, p2n, p1n + p2n - 1, gf);
+}
+
+int GF2PolyMul8(uint8_t *r, const uint8_t *p1, int p1n, const uint8_t *p2, int p2n, GF2_def_struct *gf) {
+	if ((p1n <= 0) || (p2n <= 0)) {
+		return 0;
+	}
+	memset(r, 0, p1n + p2n - 1);
+	for (int j = 0; j < p2n; j++) {
+		GF2MulAddRegion(&r[j], p1, p2[j], p1n, gf);
+	}
+	return p1n + p2n - 1;
+}
+
+int eval_log(const GF2_elem_t *p, int pn, int x_log, GF2_def_struct *gf) {
+	// Horner's rule with x held as a log below Order - 1.
+	const GF2_elem_t *table = gf->Table;
+	const GF2_elem_t *index = gf->Index;
+	int acc = 0;
+	for (int j = pn - 1; j >= 0; j--) {
+		if (acc) {
+			acc = table[index[acc] + x_log];
+		}
+		acc ^= p[j];
+	}
+	return acc;
+}
+
+int GF2PolyEval(const GF2_elem_t *p, int pn, int x, GF2_def_struct *gf) {
+	x &= gf->Mask;
+	if (x == 0) {
+		return (pn > 0) ? p[0] : 0;
+	}
+	return eval_log(p, pn, gf->Index[x], gf);
+}
+
+void GF2PolyEvalMany(GF2_elem_t *results, const GF2_elem_t *p, int pn, const GF2_elem_t *x_logs, int count, GF2_def_struct *gf) {
+	int period = gf->Order - 1;
+	for (int k = 0; k < count; k++) {
+		results[k] = eval_log(p, pn, x_logs[k] % period, gf);
+	}
+}
+
+int GF2PolyDeriv(GF2_elem_t *r, const GF2_elem_t *p, int pn) {
+	for (int i = 0; i < pn - 1; i++) {
+		r[i] = (i & 1) ? 0 : p[i + 1];
+	}
+	return (pn > 1) ? pn - 1 : 0;
+}
+
+int GF2PolyRem(GF2_elem_t *p, int pn, const GF2_elem_t *d, int dn, GF2_def_struct *gf) {
+	if ((dn <= 0) || (d[dn - 1] == 0)) {
+		return -1;
+	}
+	if (pn < dn) {
+		return pn;
+	}
+	const GF2_elem_t *table = gf->Table;
+	const GF2_elem_t *index = gf->Index;
+	int period = gf->Order - 1;
+	int lead_log = index[d[dn - 1]];
+	for (int k = pn - 1; k >= dn - 1; k--) {
+		if (p[k] == 0) {
+			continue;
+		}
+		// Quotient term p[k] / d[dn - 1] at x^(k - dn + 1), as a log below
+		// Order - 1, so adding a divisor log stays inside the doubled table.
+		int q_log = index[p[k]] + period - lead_log;
+		if (q_log >= period) {
+			q_log -= period;
+		}
+		for (int i = 0; i < dn; i++) {
+			if (d[i]) {
+				p[k - dn + 1 + i] ^= table[q_log + index[d[i]]];
+			}
+		}
+	}
+	return dn - 1;
+}
@@ -0,0 +1,84 @@
+/*
+ * File:   gf2_poly.h
+ *
+ * Created on October 17, 2026
+ */
+
+#ifndef GF2_POLY_H
+#define	GF2_POLY_H
+
+#include <stdint.h>
+#include "gf2_def_struct.h"
+
+// Polynomials are arrays of field elements, lowest power at the lowest
+// address, with a coefficient count. Products and evaluations add logs on
+// the doubled antilog table, and need no scratch memory.
+
+// GF2PolyMul
+// Multiplies two polynomials. The result may be the first operand, since it
+// is computed from the highest coefficient down, but not the second.
+// Arg1: pointer to result, p1n + p2n - 1 coefficients
+// Arg2: pointer to polynomial 1
+// Arg3: number of coefficients in polynomial 1
+// Arg4: pointer to polynomial 2
+// Arg5: number of coefficients in polynomial 2
+// Returns number of result coefficients, p1n + p2n - 1.
+int GF2PolyMul(GF2_elem_t*, const GF2_elem_t*, int, const GF2_elem_t*, int, GF2_def_struct*);
+
+// GF2PolyMulTrunc
+// Multiplies two polynomials modulo x^Arg6, computing only the coefficients
+// kept. The result may be the first operand, but not the second.
+// Arg1: pointer to result, Arg6 coefficients
+// Arg2-Arg5: polynomials as for GF2PolyMul
+// Arg6: number of result coefficients
+// Returns Arg6.
+int GF2PolyMulTrunc(GF2_elem_t*, const GF2_elem_t*, int, const GF2_elem_t*, int, int, GF2_def_struct*);
+
+// GF2PolyMul8
+// Multiplies two byte polynomials with the region multiply-accumulate kernel,
+// one pass over polynomial 1 per coefficient of polynomial 2. Fields of 8
+// bits or less only. The result must not overlap either operand.
+// Arg1-Arg5: as for GF2PolyMul
+// Returns number of result coefficients, p1n + p2n - 1.
+int GF2PolyMul8(uint8_t*, const uint8_t*, int, const uint8_t*, int, GF2_def_struct*);
+
+// GF2PolyEval
+// Evaluates a polynomial at one point, by Horner's rule.
+// Arg1: pointer to polynomial
+// Arg2: number of coefficients
+// Arg3: point
+// Returns the value.
+int GF2PolyEval(const GF2_elem_t*, int, int, GF2_def_struct*);
+
+// GF2PolyEvalMany
+// Evaluates a polynomial at many points, given as logs, so each Horner step
+// is one table add. Logs may be any non-negative int; they are reduced
+// modulo Order - 1.
+// Arg1: pointer to results, one per point
+// Arg2: pointer to polynomial
+// Arg3: number of coefficients
+// Arg4: pointer to point logs
+// Arg5: number of points
+void GF2PolyEvalMany(GF2_elem_t*, const GF2_elem_t*, int, const GF2_elem_t*, int, GF2_def_struct*);
+
+// GF2PolyDeriv
+// Formal derivative. In characteristic 2 the even powers drop out, so
+// coefficient i of the result is coefficient i + 1 of the input when i is
+// even, and zero otherwise. The result may be the input.
+// Arg1: pointer to result, pn - 1 coefficients
+// Arg2: pointer to polynomial
+// Arg3: number of coefficients
+// Returns number of result coefficients, pn - 1, or 0 for a constant.
+int GF2PolyDeriv(GF2_elem_t*, const GF2_elem_t*, int);
+
+// GF2PolyRem
+// Remainder of polynomial division, by long division in place.
+// Arg1: pointer to dividend; the low dn - 1 coefficients hold the remainder
+// Arg2: number of dividend coefficients
+// Arg3: pointer to divisor, with nonzero highest coefficient
+// Arg4: number of divisor coefficients
+// Returns number of remainder coefficients, or -1 if the divisor's highest
+// coefficient is zero.
+int GF2PolyRem(GF2_elem_t*, int, const GF2_elem_t*, int, GF2_def_struct*);
+
+#endif	/* GF2_POLY_H */
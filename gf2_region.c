@@ -0,0 +1,170 @@
+#include "gf2_region.h"
+#include "gf2.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define GF2_REGION_X86 1
+#include <immintrin.h>
+#endif
+
+// -1 until the first call detects the CPU. Every thread detects the same
+// value, so a racing first call is harmless.
+static int region_kernel = -1;
+
+int detect_region_kernel(void) {
+#ifdef GF2_REGION_X86
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("avx2")) {
+		return GF2_REGION_AVX2;
+	}
+	if (__builtin_cpu_supports("ssse3")) {
+		return GF2_REGION_SSSE3;
+	}
+#endif
+	return GF2_REGION_SCALAR;
+}
+
+int GF2RegionKernel(void) {
+	if (region_kernel < 0) {
+		region_kernel = detect_region_kernel();
+	}
+	return region_kernel;
+}
+
+int GF2SetRegionKernel(int kernel) {
+	int best = detect_region_kernel();
+	region_kernel = (kernel < best) ? kernel : best;
+	if (region_kernel < 0) {
+		region_kernel = GF2_REGION_SCALAR;
+	}
+	return region_kernel;
+}
+
+void muladd_scalar(uint8_t *dst, const uint8_t *src, const uint8_t *tbl, int length) {
+	for (int i = 0; i < length; i++) {
+		dst[i] ^= tbl[src[i] & 15] ^ tbl[16 + (src[i] >> 4)];
+	}
+}
+
+void mul_scalar(uint8_t *dst, const uint8_t *src, const uint8_t *tbl, int length) {
+	for (int i = 0; i < length; i++) {
+		dst[i] = tbl[src[i] & 15] ^ tbl[16 + (src[i] >> 4)];
+	}
+}
+
+#ifdef GF2_REGION_X86
+// Split-nibble multiply: each 4-bit half of a symbol selects its partial
+// product from a 16-entry table with pshufb, and the halves are XORed.
+__attribute__((target("ssse3")))
+void muladd_ssse3(uint8_t *dst, const uint8_t *src, const uint8_t *tbl, int length) {
+	__m128i lo = _mm_loadu_si128((const __m128i*)tbl);
+	__m128i hi = _mm_loadu_si128((const __m128i*)(tbl + 16));
+	__m128i mask = _mm_set1_epi8(0x0f);
+	int i = 0;
+	for (; i + 16 <= length; i += 16) {
+		__m128i s = _mm_loadu_si128((const __m128i*)(src + i));
+		__m128i p = _mm_xor_si128(_mm_shuffle_epi8(lo, _mm_and_si128(s, mask)),
+			_mm_shuffle_epi8(hi, _mm_and_si128(_mm_srli_epi64(s, 4), mask)));
+		__m128i d = _mm_loadu_si128((const __m128i*)(dst + i));
+		_mm_storeu_si128((__m128i*)(dst + i), _mm_xor_si128(d, p));
+	}
+	muladd_scalar(dst + i, src + i, tbl, length - i);
+}
+
+__attribute__((target("ssse3")))
+void mul_ssse3(uint8_t *dst, const uint8_t *src, const uint8_t *tbl, int length) {
+	__m128i lo = _mm_loadu_si128((const __m128i*)tbl);
+	__m128i hi = _mm_loadu_si128((const __m128i*)(tbl + 16));
+	__m128i mask = _mm_set1_epi8(0x0f);
+	int i = 0;
+	for (; i + 16 <= length; i += 16) {
+		__m128i s = _mm_loadu_si128((const __m128i*)(src + i));
+		__m128i p = _mm_xor_si128(_mm_shuffle_epi8(lo, _mm_and_si128(s, mask)),
+			_mm_shuffle_epi8(hi, _mm_and_si128(_mm_srli_epi64(s, 4), mask)));
+		_mm_storeu_si128((__m128i*)(dst + i), p);
+	}
+	mul_scalar(dst + i, src + i, tbl, length - i);
+}
+
+__attribute__((target("avx2")))
+void muladd_avx2(uint8_t *dst, const uint8_t *src, const uint8_t *tbl, int length) {
+	__m256i lo = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)tbl));
+	__m256i hi = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)(tbl + 16)));
+	__m256i mask = _mm256_set1_epi8(0x0f);
+	int i = 0;
+	for (; i + 32 <= length; i += 32) {
+		__m256i s = _mm256_loadu_si256((const __m256i*)(src + i));
+		__m256i p = _mm256_xor_si256(_mm256_shuffle_epi8(lo, _mm256_and_si256(s, mask)),
+			_mm256_shuffle_epi8(hi, _mm256_and_si256(_mm256_srli_epi64(s, 4), mask)));
+		__m256i d = _mm256_loadu_si256((const __m256i*)(dst + i));
+		_mm256_storeu_si256((__m256i*)(dst + i), _mm256_xor_si256(d, p));
+	}
+	// Finish with scalar code rather than calling the SSSE3 kernel, since
+	// mixing legacy SSE with dirty AVX state stalls.
+	muladd_scalar(dst + i, src + i, tbl, length - i);
+}
+
+__attribute__((target("avx2")))
+void mul_avx2(uint8_t *dst, const uint8_t *src, const uint8_t *tbl, int length) {
+	__m256i lo = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)tbl));
+	__m256i hi = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)(tbl + 16)));
+	__m256i mask = _mm256_set1_epi8(0x0f);
+	int i = 0;
+	for (; i + 32 <= length; i += 32) {
+		__m256i s = _mm256_loadu_si256((const __m256i*)(src + i));
+		__m256i p = _mm256_xor_si256(_mm256_shuffle_epi8(lo, _mm256_and_si256(s, mask)),
+			_mm256_shuffle_epi8(hi, _mm256_and_si256(_mm256_srli_epi64(s, 4), mask)));
+		_mm256_storeu_si256((__m256i*)(dst + i), p);
+	}
+	mul_scalar(dst + i, src + i, tbl, length - i);
+}
+#endif
+
+void GF2MulAddRegion(uint8_t *dst, const uint8_t *src, int c, int length, GF2_def_struct *gf) {
+	if (c == 0) {
+		return;
+	}
+	if (!gf->FastMul) {
+		// No nibble tables for this field, fall back to one multiply per symbol.
+		for (int i = 0; i < length; i++) {
+			dst[i] ^= GF2Mul(c, src[i], gf);
+		}
+		return;
+	}
+	const uint8_t *tbl = &gf->NibbleTable[(c & gf->Mask) * 32];
+	switch (GF2RegionKernel()) {
+#ifdef GF2_REGION_X86
+		case GF2_REGION_AVX2:
+			muladd_avx2(dst, src, tbl, length);
+			break;
+		case GF2_REGION_SSSE3:
+			muladd_ssse3(dst, src, tbl, length);
+			break;
+#endif
+		default:
+			muladd_scalar(dst, src, tbl, length);
+			break;
+	}
+}
+
+void GF2MulRegion(uint8_t *dst, const uint8_t *src, int c, int length, GF2_def_struct *gf) {
+	if (!gf->FastMul) {
+		for (int i = 0; i < length; i++) {
+			dst[i] = GF2Mul(c, src[i], gf);
+		}
+		return;
+	}
+	const uint8_t *tbl = &gf->NibbleTable[(c & gf->Mask) * 32];
+	switch (GF2RegionKernel()) {
+#ifdef GF2_REGION_X86
+		case GF2_REGION_AVX2:
+			mul_avx2(dst, src, tbl, length);
+			break;
+		case GF2_REGION_SSSE3:
+			mul_ssse3(dst, src, tbl, length);
+			break;
+#endif
+		default:
+			mul_scalar(dst, src, tbl, length);
+			break;
+	}
+}
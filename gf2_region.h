@@ -0,0 +1,45 @@
+/*
+ * File:   gf2_region.h
+ *
+ * Created on October 17, 2026
+ */
+
+#ifndef GF2_REGION_H
+#define	GF2_REGION_H
+
+#include <stdint.h>
+#include "gf2_def_struct.h"
+
+// Region kernels, in order of preference.
+#define GF2_REGION_SCALAR 0
+#define GF2_REGION_SSSE3 1
+#define GF2_REGION_AVX2 2
+
+// GF2MulAddRegion
+// Multiplies each symbol of a buffer by a constant and XORs the products into
+// a second buffer: dst[i] ^= c * src[i]. Fields of 8 bits or less only.
+// Arg1: pointer to destination buffer
+// Arg2: pointer to source buffer
+// Arg3: constant multiplier
+// Arg4: number of symbols in each buffer
+void GF2MulAddRegion(uint8_t*, const uint8_t*, int, int, GF2_def_struct*);
+
+// GF2MulRegion
+// Multiplies each symbol of a buffer by a constant: dst[i] = c * src[i].
+// Destination may be the same buffer as the source. Fields of 8 bits or less.
+// Arg1: pointer to destination buffer
+// Arg2: pointer to source buffer
+// Arg3: constant multiplier
+// Arg4: number of symbols in each buffer
+void GF2MulRegion(uint8_t*, const uint8_t*, int, int, GF2_def_struct*);
+
+// GF2RegionKernel
+// Returns the kernel in use, chosen from CPUID on first call.
+int GF2RegionKernel(void);
+
+// GF2SetRegionKernel
+// Forces a kernel, for benchmarking. Kernels the CPU lacks are downgraded.
+// Returns the kernel actually selected.
+int GF2SetRegionKernel(int);
+
+#endif	/* GF2_REGION_H */
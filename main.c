@@ -1,59 +1,57 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
 #include "gf2.h"
 #include "rs2.h"
+#include "rs2_pool.h"
+#include "rng.h"
+#include "rs2_stats.h"
 
-#define MAX_BUFFER MAX_FIELD_SIZE
+// Runs per task handed to the worker threads. Doubled as needed to keep the
+// number of tasks, each with its own random stream, under MAX_TASKS.
+#define RUN_CHUNK 256
+#define MAX_TASKS 65536
+// Default minimum time between progress updates, in milliseconds.
+#define PROGRESS_INTERVAL 250
 
-void GenRandomMessage(int *buffer, int mask, int size) {
-	for (int i = 0; i < size; i++) {
-		buffer[i] = rand() & mask;
-	}
+void GenRandomMessage(uint16_t *buffer, int bits, int size, RNG_def_struct *rng) {
+	RNGFillSymbols(buffer, size, bits, rng);
 }
-void CopyMessage(int *in, int *out, int size) {
+void CopyMessage(uint16_t *in, uint16_t *out, int size) {
 	for (int i = 0; i < size; i++) {
 		out[i] = in[i];
 	}
 }
 
-void GenErrorVector(int *buffer, int mask, int size, int count) {
-	int error_locs[MAX_BUFFER];
-	// Clear error buffers
-	for (int i = 0; i < size; i++) {
-		buffer[i] = 0;
-		error_locs[i] = 0;
-	}
-	// Generate count unique error locations in range 0:(size-1)
-	int error_index = 0;
-	while(error_index < count) {
-		int candidate_location = rand() % size;
-		int is_unique = 1;
-		int i = 0;
-		while (is_unique && (i < error_index)) {
-			if (error_locs[i++] == candidate_location) {
-				is_unique = 0;
-			}
-		}
-		if (is_unique) {
-			error_locs[error_index++] = candidate_location;
-		}
+void GenErrorVector(uint16_t *buffer, uint16_t *positions, int mask, int size, int count, RNG_def_struct *rng) {
+	// Places count nonzero errors at unique random locations in range
+	// 0:(size-1). Buffer must be all zero on entry; positions must hold a
+	// permutation of 0:(size-1), and its first count entries are the chosen
+	// locations on return. A partial Fisher-Yates shuffle picks them.
+	for (int i = 0; i < count; i++) {
+		int j = i + RNGBounded(size - i, rng);
+		uint16_t swap = positions[i];
+		positions[i] = positions[j];
+		positions[j] = swap;
+		buffer[positions[i]] = 1 + RNGBounded(mask, rng);
 	}
+}
+
+void ClearErrorVector(uint16_t *buffer, uint16_t *positions, int count) {
 	for (int i = 0; i < count; i++) {
-		int x = 0;
-		while (x == 0) {
-			x = rand() & mask;
-		}
-		buffer[error_locs[i]] = x;
+		buffer[positions[i]] = 0;
 	}
 }
 
-void CombineVectors(int *in1, int *in2, int *out, int count) {
+void ApplyErrors(uint16_t *buffer, uint16_t *error_vector, uint16_t *positions, int count) {
 	for (int i = 0; i < count; i++) {
-		out[i] = in1[i] ^ in2[i];
+		buffer[positions[i]] ^= error_vector[positions[i]];
 	}
 }
 
-int CompareVectors(int *a, int *b, int size) {
+int CompareVectors(uint16_t *a, uint16_t *b, int size) {
 	int errors = 0;
 	for (int i = 0; i < size; i++) {
 		if (a[i] ^ b[i]) {
@@ -63,11 +61,393 @@ int CompareVectors(int *a, int *b, int size) {
 	return errors;
 }
 
+typedef struct {
+	int *successes;
+	int *decoder_indicated_failures;
+	int *failures;
+	int *undetected_failures;
+	int *artificial_codewords;
+} Counts_def_struct;
+
+struct Harness_def_struct;
+
+typedef struct {
+	struct Harness_def_struct *harness;
+	pthread_t thread;
+	int id;
+	// Task queue: the owner takes from NextTask, thieves take from the end.
+	pthread_mutex_t lock;
+	int NextTask;
+	int EndTask;
+	RS2_work_struct ws;
+	RS2_pool_struct pool; // started only with -b
+	Counts_def_struct counts;
+	// Block buffers, block_size symbols each, allocated by AllocBuffers.
+	uint16_t *original_message;
+	uint16_t *error_vector;
+	uint16_t *corrupt_message;
+	uint16_t *reencoded_message;
+	uint16_t *error_positions;
+	int *erasures;
+} Worker_def_struct;
+
+typedef struct Harness_def_struct {
+	GF2_def_struct *gf;
+	RS2_def_struct *rs;
+	int block_size;
+	int message_size;
+	int parity_size;
+	int max_errors;
+	int erasure_count; // erased symbols per block, on top of the errors
+	int run_count;
+	int seed;
+	int run_chunk; // runs per task
+	int chunks_per_count; // tasks per error count
+	int task_count;
+	RNG_def_struct *streams; // one random stream per task
+	int worker_count;
+	Worker_def_struct *workers;
+	pthread_mutex_t print_lock;
+	int completed_runs;
+	int quiet; // summary only: no progress, tables or failure dumps
+	double progress_interval; // seconds between progress updates
+	double last_progress;
+	FILE *failure_log; // failures go here as CSV instead of to the console
+	int logged_failures;
+} Harness_def_struct;
+
+int AllocCounts(Counts_def_struct *c, int size) {
+	c->successes = calloc(size, sizeof(int));
+	c->decoder_indicated_failures = calloc(size, sizeof(int));
+	c->failures = calloc(size, sizeof(int));
+	c->undetected_failures = calloc(size, sizeof(int));
+	c->artificial_codewords = calloc(size, sizeof(int));
+	if (!c->successes || !c->decoder_indicated_failures || !c->failures || !c->undetected_failures || !c->artificial_codewords) {
+		return -1;
+	}
+	return 0;
+}
+
+void FreeCounts(Counts_def_struct *c) {
+	free(c->successes);
+	free(c->decoder_indicated_failures);
+	free(c->failures);
+	free(c->undetected_failures);
+	free(c->artificial_codewords);
+}
+
+int AllocBuffers(Worker_def_struct *w, int size) {
+	w->original_message = calloc(size, sizeof(uint16_t));
+	w->error_vector = calloc(size, sizeof(uint16_t));
+	w->corrupt_message = calloc(size, sizeof(uint16_t));
+	w->reencoded_message = calloc(size, sizeof(uint16_t));
+	w->error_positions = calloc(size, sizeof(uint16_t));
+	w->erasures = calloc(size, sizeof(int));
+	if (!w->original_message || !w->error_vector || !w->corrupt_message || !w->reencoded_message || !w->error_positions || !w->erasures) {
+		return -1;
+	}
+	return 0;
+}
+
+void FreeBuffers(Worker_def_struct *w) {
+	free(w->original_message);
+	free(w->error_vector);
+	free(w->corrupt_message);
+	free(w->reencoded_message);
+	free(w->error_positions);
+	free(w->erasures);
+}
+
+void MergeCounts(Counts_def_struct *total, Counts_def_struct *c, int size) {
+	for (int i = 0; i < size; i++) {
+		total->successes[i] += c->successes[i];
+		total->decoder_indicated_failures[i] += c->decoder_indicated_failures[i];
+		total->failures[i] += c->failures[i];
+		total->undetected_failures[i] += c->undetected_failures[i];
+		total->artificial_codewords[i] += c->artificial_codewords[i];
+	}
+}
+
+double Seconds(void) {
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (double)now.tv_sec + (now.tv_nsec * 1e-9);
+}
+
+void PrintFailure(Worker_def_struct *w) {
+	// Caller holds the print lock.
+	Harness_def_struct *h = w->harness;
+	int block_size = h->block_size;
+	printf("\r\n          Original Message, Encoded:");
+	for (int i = 0; i < block_size; i++) {
+		printf(" %i", w->original_message[i]);
+	}
+	printf("\r\n          Actual Error Vector:");
+	for (int i = 0; i < block_size; i++) {
+		printf(" %i", w->error_vector[i]);
+	}
+	printf("\r\n          Corrupt Message:");
+	for (int i = 0; i < block_size; i++) {
+		printf(" %i", w->corrupt_message[i]);
+	}
+	printf("\r\n          Syndromes:");
+	for (int i = 0; i < h->rs->NumRoots; i++) {
+		printf(" %i", w->ws.SavedSyndromes[i]);
+	}
+	printf("\r\n          Erasures:");
+	for (int i = 0; i < h->erasure_count; i++) {
+		printf(" %i", w->erasures[i]);
+	}
+	printf("\r\n          Detected error indices: ");
+	for (int i = 0; i < w->ws.ErrorCount; i++) {
+		printf(" %i", w->ws.ErrorIndices[i]);
+	}
+	printf("\r\n          Detected error roots: ");
+	for (int i = 0; i < w->ws.ErrorCount; i++) {
+		printf(" %i", w->ws.ErrorLocatorRoots[i]);
+	}
+	printf("\r\n          Detected error magnitudes: ");
+	for (int i = 0; i < w->ws.ErrorCount; i++) {
+		printf(" %i", w->ws.ErrorMags[i]);
+	}
+	printf("\r\n          Error Locator Poly:");
+	for (int i = 0; i <= (h->rs->NumRoots + h->erasure_count)/2; i++) {
+		printf(" %i", w->ws.ErrorLocatorPoly[i]);
+	}
+	printf("\r\n          Error Magnitude Poly:");
+	for (int i = 0; i <= (h->rs->NumRoots + h->erasure_count)/2; i++) {
+		printf(" %i", w->ws.ErrorMagPoly[i]);
+	}
+}
+
+void LogFailure(Worker_def_struct *w, int error_count, int result) {
+	// Caller holds the print lock. One CSV record per failure: error count,
+	// erasure count, decoder result, the encoded block, the corrupt block and
+	// the erasure positions. ReplayFailures reads it back.
+	Harness_def_struct *h = w->harness;
+	FILE *log = h->failure_log;
+	fprintf(log, "%i,%i,%i", error_count, h->erasure_count, result);
+	for (int i = 0; i < h->block_size; i++) {
+		fprintf(log, ",%i", w->original_message[i]);
+	}
+	for (int i = 0; i < h->block_size; i++) {
+		fprintf(log, ",%i", w->original_message[i] ^ w->error_vector[i]);
+	}
+	for (int i = 0; i < h->erasure_count; i++) {
+		fprintf(log, ",%i", w->erasures[i]);
+	}
+	fprintf(log, "\n");
+	h->logged_failures++;
+}
+
+int ReadFields(char **line, int *values, int count) {
+	// Parses count comma separated integers. Returns 0, or -1 if short.
+	for (int i = 0; i < count; i++) {
+		char *end;
+		values[i] = (int)strtol(*line, &end, 10);
+		if (end == *line) {
+			return -1;
+		}
+		*line = (*end == ',') ? end + 1 : end;
+	}
+	return 0;
+}
+
+int ReplayFailures(Worker_def_struct *w, const char *name) {
+	// Decodes each block of a failure log again and prints the full
+	// diagnostics. The log must be from the same code and erasure count.
+	// Returns the number of blocks that still fail, or -1 on a bad log.
+	Harness_def_struct *h = w->harness;
+	FILE *log = fopen(name, "r");
+	if (log == NULL) {
+		printf("\r\nCould not open failure log %s.\r\n", name);
+		return -1;
+	}
+	char *line = NULL;
+	size_t capacity = 0;
+	int header[5];
+	if ((getline(&line, &capacity, log) < 0) || (sscanf(line, "# rs-test failures, gf %i, first root %i, block size %i, message size %i, erasures %i",
+		&header[0], &header[1], &header[2], &header[3], &header[4]) != 5) || (header[0] != h->gf->GenPoly) || (header[1] != h->rs->FirstRoot)
+		|| (header[2] != h->block_size) || (header[3] != h->message_size) || (header[4] != h->erasure_count)) {
+		printf("\r\nFailure log %s is not from this code and erasure count.\r\n", name);
+		free(line);
+		fclose(log);
+		return -1;
+	}
+	int fields[3];
+	int *block = malloc(sizeof(int) * h->block_size);
+	int replayed = 0;
+	int failed = 0;
+	while ((block != NULL) && (getline(&line, &capacity, log) > 0)) {
+		char *cursor = line;
+		if ((ReadFields(&cursor, fields, 3) < 0) || (ReadFields(&cursor, block, h->block_size) < 0)) {
+			break;
+		}
+		for (int i = 0; i < h->block_size; i++) {
+			w->original_message[i] = block[i];
+		}
+		if ((ReadFields(&cursor, block, h->block_size) < 0) || (ReadFields(&cursor, w->erasures, h->erasure_count) < 0)) {
+			break;
+		}
+		for (int i = 0; i < h->block_size; i++) {
+			w->corrupt_message[i] = block[i];
+			w->error_vector[i] = w->original_message[i] ^ block[i];
+		}
+		int result = RSDecodeErasures16(w->corrupt_message, h->block_size, w->erasures, h->erasure_count, h->rs, &w->ws);
+		int errors = CompareVectors(w->corrupt_message, w->original_message, h->block_size);
+		replayed++;
+		printf("\r\nFailure %i: %i errors, %i erasures, logged result %i, replayed result %i, %s.", replayed, fields[0], fields[1], fields[2], result,
+			errors ? "still fails" : "now corrects");
+		if (errors) {
+			failed++;
+			PrintFailure(w);
+		}
+	}
+	printf("\r\nReplayed %i failures, %i still fail.\r\n", replayed, failed);
+	free(block);
+	free(line);
+	fclose(log);
+	return failed;
+}
+
+void RunTrial(Worker_def_struct *w, int error_count, RNG_def_struct *rng) {
+	Harness_def_struct *h = w->harness;
+	int block_size = h->block_size;
+	int message_size = h->message_size;
+	// Generate a random message to encode.
+	GenRandomMessage(w->original_message, h->gf->Power, message_size, rng);
+	// Encode message in Reed Solomon block.
+	RSEncode16(w->original_message, message_size, h->rs);
+
+	// Corrupt error_count unknown positions, then erasure_count more
+	// positions that the decoder is told about.
+	int corrupt_count = error_count + h->erasure_count;
+	GenErrorVector(w->error_vector, w->error_positions, h->gf->Order - 1, block_size, corrupt_count, rng);
+	CopyMessage(w->original_message, w->corrupt_message, block_size);
+	ApplyErrors(w->corrupt_message, w->error_vector, w->error_positions, corrupt_count);
+	for (int i = 0; i < h->erasure_count; i++) {
+		w->erasures[i] = w->error_positions[error_count + i];
+	}
+
+	CopyMessage(w->corrupt_message, w->reencoded_message, message_size);
+	RSEncode16(w->reencoded_message, message_size, h->rs);
+	// Check if the randomly corrupted message is also a valid codeword
+	if ((CompareVectors(w->corrupt_message, w->reencoded_message, block_size) == 0) && (corrupt_count > 1)) {
+		w->counts.artificial_codewords[error_count]++;
+	}
+
+	int corrected_count = RSDecodeErasures16(w->corrupt_message, block_size, w->erasures, h->erasure_count, h->rs, &w->ws);
+	if (corrected_count < 0) {
+		w->counts.decoder_indicated_failures[error_count]++;
+	}
+
+	int errors = CompareVectors(w->corrupt_message, w->original_message, block_size);
+	if (errors > 0) {
+		w->counts.failures[error_count]++;
+		if (corrected_count >= 0) {
+			w->counts.undetected_failures[error_count]++;
+		}
+	} else {
+		w->counts.successes[error_count]++;
+	}
+	if ((errors > 0) && ((2 * error_count) + h->erasure_count <= h->parity_size)) {
+		pthread_mutex_lock(&h->print_lock);
+		if (h->failure_log) {
+			LogFailure(w, error_count, corrected_count);
+		} else if (!h->quiet) {
+			PrintFailure(w);
+		}
+		pthread_mutex_unlock(&h->print_lock);
+	}
+	ClearErrorVector(w->error_vector, w->error_positions, corrupt_count);
+}
+
+void RunTask(Worker_def_struct *w, int task) {
+	// A task is one chunk of runs at one error count. Its random stream
+	// is the seeded generator jumped once per task number, so results do
+	// not depend on which worker runs it.
+	Harness_def_struct *h = w->harness;
+	int error_count = task / h->chunks_per_count;
+	int first_run = (task % h->chunks_per_count) * h->run_chunk;
+	int last_run = first_run + h->run_chunk;
+	if (last_run > h->run_count) {
+		last_run = h->run_count;
+	}
+	RNG_def_struct rng = h->streams[task];
+	// The shuffle leaves error_positions permuted; restart each task from
+	// the identity so the draws depend only on the task's own stream.
+	for (int i = 0; i < h->block_size; i++) {
+		w->error_positions[i] = i;
+	}
+	for (int run = first_run; run < last_run; run++) {
+		RunTrial(w, error_count, &rng);
+	}
+	pthread_mutex_lock(&h->print_lock);
+	h->completed_runs += last_run - first_run;
+	if (!h->quiet) {
+		// Throttled, so the console costs the same at any run count.
+		double now = Seconds();
+		if (now - h->last_progress >= h->progress_interval) {
+			h->last_progress = now;
+			printf("\r%i", h->completed_runs);
+			fflush(stdout);
+		}
+	}
+	pthread_mutex_unlock(&h->print_lock);
+}
+
+int TakeTask(Worker_def_struct *w) {
+	// Take the next task from our own queue.
+	int task = -1;
+	pthread_mutex_lock(&w->lock);
+	if (w->NextTask < w->EndTask) {
+		task = w->NextTask++;
+	}
+	pthread_mutex_unlock(&w->lock);
+	return task;
+}
+
+int StealTasks(Worker_def_struct *w) {
+	// Our queue is empty: move the back half of another worker's queue
+	// into ours. Returns 0 when there is nothing left anywhere.
+	Harness_def_struct *h = w->harness;
+	for (int i = 1; i < h->worker_count; i++) {
+		Worker_def_struct *victim = &h->workers[(w->id + i) % h->worker_count];
+		pthread_mutex_lock(&victim->lock);
+		int remaining = victim->EndTask - victim->NextTask;
+		if (remaining > 0) {
+			int stolen = (remaining + 1) / 2;
+			int end = victim->EndTask;
+			victim->EndTask -= stolen;
+			pthread_mutex_unlock(&victim->lock);
+			pthread_mutex_lock(&w->lock);
+			w->NextTask = end - stolen;
+			w->EndTask = end;
+			pthread_mutex_unlock(&w->lock);
+			return 1;
+		}
+		pthread_mutex_unlock(&victim->lock);
+	}
+	return 0;
+}
+
+void *RunWorker(void *arg) {
+	Worker_def_struct *w = arg;
+	do {
+		int task;
+		while ((task = TakeTask(w)) >= 0) {
+			RunTask(w, task);
+		}
+	} while (StealTasks(w));
+	return NULL;
+}
+
+
 int main(int arg_count, char* arg_values[]) {
 	
 	if (arg_count < 8) {
 		printf("Not enough arguments.\r\n");
-		printf("Usage:\r\nrs-test <gf poly> <rs first root> <block size> <message size> <max error count> <runs> <seed>\r\n");
+		printf("Usage:\r\nrs-test <gf poly> <rs first root> <block size> <message size> <max error count> <runs> <seed> [-t <threads>] [-b <threads>] [-e <erasures>] [-s] [-q] [-p <ms>] [-l <log>] [-r <log>]\r\n");
 		printf("\r\nExample: rs-test 285 0 15 13 7 100000 0");
 		printf("\r\n\n     gf poly:");
 		printf("\r\n              Integer number representing the Galois Field reducing polynomial, in GF(2).");
@@ -91,6 +471,30 @@ int main(int arg_count, char* arg_values[]) {
 		printf("\r\n              Error count will span from zero to (n-k).");
 		printf("\r\n\n     seed:");
 		printf("\r\n              Integer number used to seed random number generator, for test repeatability.");
+		printf("\r\n\n     -t <threads>:");
+		printf("\r\n              Optional number of worker threads, default 1. Results are repeatable for a");
+		printf("\r\n              given seed regardless of thread count.");
+		printf("\r\n\n     -b <threads>:");
+		printf("\r\n              Optional number of threads decoding each block, default 1. Splits the");
+		printf("\r\n              syndromes and Chien search of blocks of %i symbols or more. Each", RS2_PARALLEL_MIN_BLOCK);
+		printf("\r\n              worker thread gets a pool of its own.");
+		printf("\r\n\n     -e <erasures>:");
+		printf("\r\n              Optional number of erased symbols per block, default 0. Each run corrupts this");
+		printf("\r\n              many extra random locations and passes them to the decoder as erasures, on");
+		printf("\r\n              top of the swept error count. Correctable while 2 * errors + erasures <= n-k.");
+		printf("\r\n\n     -s:");
+		printf("\r\n              Optional. Prints decoder stage timing, counters and latency by error count.");
+		printf("\r\n              Needs a build with -DRS2_STATS.");
+		printf("\r\n\n     -q:");
+		printf("\r\n              Optional. Summary only: prints the result tables and nothing else.");
+		printf("\r\n\n     -p <ms>:");
+		printf("\r\n              Optional minimum time between progress updates, default %i milliseconds.", PROGRESS_INTERVAL);
+		printf("\r\n\n     -l <log>:");
+		printf("\r\n              Optional. Writes failures within the correction limit to a CSV log file");
+		printf("\r\n              instead of printing them.");
+		printf("\r\n\n     -r <log>:");
+		printf("\r\n              Optional. Decodes each block of a failure log written by -l with the same");
+		printf("\r\n              code and erasure count, and prints the diagnostics, instead of running.");
 		printf("\r\n");
 
 		return(-1);
@@ -104,7 +508,49 @@ int main(int arg_count, char* arg_values[]) {
 	int run_count = atoi(arg_values[6]);
 	int seed = atoi(arg_values[7]);
 	int parity_size = block_size - message_size;
-	srand(seed);
+	int thread_count = 1;
+	int block_threads = 1;
+	int erasure_count = 0;
+	int print_stats = 0;
+	int quiet = 0;
+	int progress_ms = PROGRESS_INTERVAL;
+	const char *log_name = NULL;
+	const char *replay_name = NULL;
+	for (int i = 8; i < arg_count; i++) {
+		if ((arg_values[i][0] == '-') && (arg_values[i][1] == 't') && (i + 1 < arg_count)) {
+			thread_count = atoi(arg_values[++i]);
+		} else if ((arg_values[i][0] == '-') && (arg_values[i][1] == 'b') && (i + 1 < arg_count)) {
+			block_threads = atoi(arg_values[++i]);
+		} else if ((arg_values[i][0] == '-') && (arg_values[i][1] == 'e') && (i + 1 < arg_count)) {
+			erasure_count = atoi(arg_values[++i]);
+		} else if ((arg_values[i][0] == '-') && (arg_values[i][1] == 's')) {
+			print_stats = 1;
+		} else if ((arg_values[i][0] == '-') && (arg_values[i][1] == 'q')) {
+			quiet = 1;
+		} else if ((arg_values[i][0] == '-') && (arg_values[i][1] == 'p') && (i + 1 < arg_count)) {
+			progress_ms = atoi(arg_values[++i]);
+		} else if ((arg_values[i][0] == '-') && (arg_values[i][1] == 'l') && (i + 1 < arg_count)) {
+			log_name = arg_values[++i];
+		} else if ((arg_values[i][0] == '-') && (arg_values[i][1] == 'r') && (i + 1 < arg_count)) {
+			replay_name = arg_values[++i];
+		} else {
+			printf("\r\nUnknown option %s.\r\n", arg_values[i]);
+			return(-1);
+		}
+	}
+	if (thread_count < 1) {
+		printf("\r\nThread count %i is too small. Must be greater than zero.\r\n", thread_count);
+		return(-1);
+	}
+	if (block_threads < 1) {
+		printf("\r\nBlock thread count %i is too small. Must be greater than zero.\r\n", block_threads);
+		return(-1);
+	}
+	
+	if ((gf_poly < 2) || (gf_poly >= (1 << (MAX_GF_BITS + 1)))) {
+		printf("\r\nGalois Field generator polynomial %i is out of range. Fields of 1 to %i bits are supported.\r\n", gf_poly, MAX_GF_BITS);
+		return(-1);
+	}
 	
 	// Initialize Galois Field.
 	GF2_def_struct gf;
@@ -112,9 +558,12 @@ int main(int arg_count, char* arg_values[]) {
 	if (gf_status > 0) {
 		printf("\r\nGalois Field generator polynomial %i is not irreducible, field repeated %i times.\r\n", gf_poly, gf_status);
 		return(-1);
-	} else if (gf_status < 0) {
+	} else if (gf_status == -1) {
 		printf("\r\nGalois Field generator polynomial %i is even, must be odd.\r\n", gf_poly);
 		return(-1);
+	} else if (gf_status < 0) {
+		printf("\r\nCould not allocate the tables for Galois Field generator polynomial %i.\r\n", gf_poly);
+		return(-1);
 	} else {
 	}
 	
@@ -132,168 +581,202 @@ int main(int arg_count, char* arg_values[]) {
 		printf("\r\nMax error count %i is too large. Must be less than or equal to block size %i.\r\n", max_errors, block_size);
 		return(-1);
 	}
+	if ((erasure_count < 0) || (erasure_count > parity_size)) {
+		printf("\r\nErasure count %i is out of range. Must be from zero to parity size %i.\r\n", erasure_count, parity_size);
+		return(-1);
+	}
+	if (max_errors + erasure_count > block_size) {
+		printf("\r\nMax error count %i plus erasure count %i is too large. Must be less than or equal to block size %i.\r\n", max_errors, erasure_count, block_size);
+		return(-1);
+	}
 	if (max_errors < 1) {
 		printf("\r\nMax error count %i is too small. Must be greater than zero.\r\n", max_errors);
 		return(-1);
 	}
 	
 
-	printf("\r\nGalois Field generator polynomial %i is irreducible.", gf_poly);
-	printf("\r\nGalois Field contains %i elements.", gf.Order);
-	printf("\r\nGalois Field element size is %i bits.", gf.Power);
+	if (!quiet) {
+		printf("\r\nGalois Field generator polynomial %i is irreducible.", gf_poly);
+		printf("\r\nGalois Field contains %i elements.", gf.Order);
+		printf("\r\nGalois Field element size is %i bits.", gf.Power);
 
-	printf("\r\nGalois Field Table:");
-	for (int i = 0; i < gf.Order; i++) {
-		if ((i % 16) == 0) {
-			printf("\r\n");
+		printf("\r\nGalois Field Table:");
+		if (gf.Order > 1024) {
+			printf(" omitted for fields over 1024 elements.");
 		}
-		if (i == 0) {
-			printf("%5i", 0);
-		} else {
-			printf("%5i", gf.Table[i-1]);
+		for (int i = 0; (i < gf.Order) && (gf.Order <= 1024); i++) {
+			if ((i % 16) == 0) {
+				printf("\r\n");
+			}
+			if (i == 0) {
+				printf("%5i", 0);
+			} else {
+				printf("%5i", gf.Table[i-1]);
+			}
 		}
-	}
-
 
-	printf("\r\nSize of int variable is %li bits.", sizeof(int)*8);
+		printf("\r\nSize of int variable is %li bits.", sizeof(int)*8);
+	}
 	
 	RS2_def_struct rs;
 	rs.GF = &gf;
-	InitRS2(rs_first_root, parity_size, &rs);
-
-	printf("\r\nReed Solomon Generator Polynomial, highest coefficient first:\r\n");
-	for(int i = 0; i < rs.NumRoots + 1; i++){
-		printf("%i ", rs.Genpoly[i]);
-	}
-	printf("\r\n");
-
-	int original_message[MAX_BUFFER];
-	int error_vector[MAX_BUFFER];
-	int corrupt_message[MAX_BUFFER];
-	int decoded_message[MAX_BUFFER];
-	int reencoded_message[MAX_BUFFER];
-
-	int decoder_indicated_failures[MAX_FIELD_SIZE];
-	int failures[MAX_FIELD_SIZE];
-	int undetected_failures[MAX_FIELD_SIZE];
-	int successes[MAX_FIELD_SIZE];
-	int artificial_codewords[MAX_FIELD_SIZE];
-	for (int i = 0; i <= MAX_FIELD_SIZE; i++) {
-		failures[i] = 0;
-		undetected_failures[i] = 0;
-		successes[i] = 0;
-		decoder_indicated_failures[i] = 0;
-		artificial_codewords[i] = 0;
-	}
-
-	printf("\r\nStarting %i runs.\r\n", (max_errors + 1) * run_count);
-	int master_count = 1;
-	
-	for (int error_count = 0; error_count <= max_errors; error_count++) {
-		for (int run_number = 1; run_number <= run_count; run_number++) {
-			// printf("\r\n\nError Count %i, Run %i, ", error_count, run_number);
-			printf("\r%i", master_count++);
-			// Generate a random message to encode.
-			GenRandomMessage(original_message, gf.Order - 1, message_size);
-			// printf("\r\nMessage:");
-			// for (int i = 0; i < message_size; i++) {
-				// printf(" %X", original_message[i]);
-			// }
-			// Encode message in Reed Solomon block.
-			RSEncode(original_message, message_size, &rs);
-			// printf("\r\nEncodedMessage:");
-			// for (int i = 0; i < block_size; i++) {
-			// 	printf(" %X", original_message[i]);
-			// }
-
-			GenErrorVector(error_vector, gf.Order - 1, block_size, error_count);
-			// printf("\r\n             Error Vector:");
-			// for (int i = 0; i < block_size; i++) {
-				// printf(" %i", error_vector[i]);
-			// }
-
-			CombineVectors(original_message, error_vector, corrupt_message, block_size);
-			// printf("\r\nCorrupt Message:");
-			// for (int i = 0; i < block_size; i++) {
-				// printf(" %X", corrupt_message[i]);
-			// }
-
-			CopyMessage(corrupt_message, reencoded_message, message_size);
-			RSEncode(reencoded_message, message_size, &rs);
-			// Check if the randomly corrupted message is also a valid codeword
-			if ((CompareVectors(corrupt_message, reencoded_message, block_size) == 0) && (error_count > 1)) {
-				artificial_codewords[error_count]++;
-			}
+	if (InitRS2(rs_first_root, parity_size, &rs) < 0) {
+		printf("\r\nCould not initialize Reed Solomon code with %i roots.\r\n", parity_size);
+		return(-1);
+	}
 
-			int corrected_count = RSDecode(corrupt_message, block_size, &rs);
-			if (corrected_count < 0) {
-				decoder_indicated_failures[error_count]++;
-			}
-			// printf("\r\nCorrected %i errors in message:", corrected_count);
-			// for (int i = 0; i < block_size; i++) {
-				// printf(" %X", corrupt_message[i]);
-			// }
-
-			int errors = CompareVectors(corrupt_message, original_message, block_size);
-			// printf("\r\nBlock size: %i, Errors: %i", block_size, errors);
-			if (errors > 0) {
-				failures[error_count]++;
-				if (corrected_count >= 0) {
-					undetected_failures[error_count]++;
-				}
-			} else {
-				successes[error_count]++;
-				// printf("\r\nSuccessful message:", corrected_count);
-				// for (int i = 0; i < block_size; i++) {
-					// printf(" %X,%X", corrupt_message[i], original_message[i]);
-				// }				
-			}
-			if ((errors > 0) && (error_count <= parity_size/2)) {
-			//if (corrected_count > 0) {
-				
-				printf("\r\n          Original Message, Encoded:");
-				for (int i = 0; i < block_size; i++) {
-					printf(" %i", original_message[i]);
-				}
-				printf("\r\n          Actual Error Vector:");
-				for (int i = 0; i < block_size; i++) {
-					printf(" %i", error_vector[i]);
-				}
-				printf("\r\n          Corrupt Message:");
-				for (int i = 0; i < block_size; i++) {
-					printf(" %i", corrupt_message[i]);
-				}
-				printf("\r\n          Syndromes:");
-				for (int i = 0; i < rs.NumRoots; i++) {
-					printf(" %i", rs.SavedSyndromes[i]);
-				}
-				printf("\r\n          Detected error indices: ");
-				for (int i = 0; i < rs.ErrorCount; i++) {
-					printf(" %i", rs.ErrorIndices[i]);
-				}
-				printf("\r\n          Detected error roots: ");
-				for (int i = 0; i < rs.ErrorCount; i++) {
-					printf(" %i", rs.ErrorLocatorRoots[i]);
-				}
-				printf("\r\n          Detected error magnitudes: ");
-				for (int i = 0; i < rs.ErrorCount; i++) {
-					printf(" %i", rs.ErrorMags[i]);
-				}
-				printf("\r\n          Error Locator Poly:");
-				for (int i = 0; i <= rs.NumRoots/2; i++) {
-					printf(" %i", rs.ErrorLocatorPoly[i]);
-				}
-				printf("\r\n          Error Magnitude Poly:");
-				for (int i = 0; i <= rs.NumRoots/2; i++) {
-					printf(" %i", rs.ErrorMagPoly[i]);
-				}
-				// printf("\r\n          RS Gen Poly:");
-				// for (int i = 0; i < rs.NumRoots+1; i++) {
-				// 	printf(" %i", rs.Genpoly[i]);
-				// }
-			}
+	if (!quiet) {
+		printf("\r\nReed Solomon Generator Polynomial, highest coefficient first:\r\n");
+		for(int i = 0; i < rs.NumRoots + 1; i++){
+			printf("%i ", rs.Genpoly[i]);
+		}
+		printf("\r\n");
+	}
+
+	// Split the sweep into tasks of run_chunk runs at one error count, and
+	// deal them out to the workers in contiguous ranges.
+	Harness_def_struct h;
+	h.gf = &gf;
+	h.rs = &rs;
+	h.block_size = block_size;
+	h.message_size = message_size;
+	h.parity_size = parity_size;
+	h.max_errors = max_errors;
+	h.erasure_count = erasure_count;
+	h.run_count = run_count;
+	h.seed = seed;
+	h.run_chunk = RUN_CHUNK;
+	while ((long)(max_errors + 1) * ((run_count + h.run_chunk - 1) / h.run_chunk) > MAX_TASKS) {
+		h.run_chunk *= 2;
+	}
+	h.chunks_per_count = (run_count + h.run_chunk - 1) / h.run_chunk;
+	h.task_count = (max_errors + 1) * h.chunks_per_count;
+	h.streams = malloc(sizeof(RNG_def_struct) * h.task_count);
+	if (h.streams == NULL) {
+		printf("\r\nCould not allocate random streams.\r\n");
+		return(-1);
+	}
+	RNG_def_struct stream;
+	RNGSeed(seed, &stream);
+	for (int i = 0; i < h.task_count; i++) {
+		h.streams[i] = stream;
+		RNGJump(&stream);
+	}
+	h.worker_count = thread_count;
+	h.completed_runs = 0;
+	h.quiet = quiet;
+	h.progress_interval = progress_ms * 1e-3;
+	h.last_progress = 0;
+	h.failure_log = NULL;
+	h.logged_failures = 0;
+	pthread_mutex_init(&h.print_lock, NULL);
+	h.workers = calloc(thread_count, sizeof(Worker_def_struct));
+	if (h.workers == NULL) {
+		printf("\r\nCould not allocate worker state.\r\n");
+		return(-1);
+	}
+	for (int i = 0; i < thread_count; i++) {
+		Worker_def_struct *w = &h.workers[i];
+		w->harness = &h;
+		w->id = i;
+		pthread_mutex_init(&w->lock, NULL);
+		w->NextTask = (int)(((long)h.task_count * i) / thread_count);
+		w->EndTask = (int)(((long)h.task_count * (i + 1)) / thread_count);
+		if ((InitRS2Work(&rs, &w->ws) < 0) || (AllocCounts(&w->counts, max_errors + 1) < 0) || (AllocBuffers(w, block_size) < 0)) {
+			printf("\r\nCould not allocate worker state.\r\n");
+			return(-1);
+		}
+		if ((InitRS2Pool(block_threads, &w->pool) < 0) || (RS2SetPool(&w->ws, &w->pool) < 0)) {
+			printf("\r\nCould not start %i block threads.\r\n", block_threads);
+			return(-1);
+		}
+	}
+
+	if (replay_name) {
+		int still_failing = ReplayFailures(&h.workers[0], replay_name);
+		for (int i = 0; i < thread_count; i++) {
+			FreeCounts(&h.workers[i].counts);
+			FreeBuffers(&h.workers[i]);
+			FreeRS2Work(&h.workers[i].ws);
+			FreeRS2Pool(&h.workers[i].pool);
+			pthread_mutex_destroy(&h.workers[i].lock);
 		}
+		free(h.workers);
+		free(h.streams);
+		FreeRS2(&rs);
+		FreeGF2(&gf);
+		return (still_failing == 0) ? 0 : -1;
+	}
+	if (log_name) {
+		h.failure_log = fopen(log_name, "w");
+		if (h.failure_log == NULL) {
+			printf("\r\nCould not open failure log %s.\r\n", log_name);
+			return(-1);
+		}
+		// Records are written under the print lock; a large buffer keeps
+		// the file writes out of the run loop.
+		setvbuf(h.failure_log, NULL, _IOFBF, 1 << 20);
+		fprintf(h.failure_log, "# rs-test failures, gf %i, first root %i, block size %i, message size %i, erasures %i\n",
+			gf_poly, rs_first_root, block_size, message_size, erasure_count);
+	}
+
+	if (!quiet) {
+		printf("\r\nStarting %i runs on %i threads.\r\n", (max_errors + 1) * run_count, thread_count);
+		if (block_threads > 1) {
+			printf("Blocks of %i symbols or more are decoded on %i threads each.\r\n", RS2_PARALLEL_MIN_BLOCK, block_threads);
+		}
+		if (erasure_count > 0) {
+			printf("Each block also carries %i erasures.\r\n", erasure_count);
+		}
+	}
+
+	if (thread_count == 1) {
+		RunWorker(&h.workers[0]);
+	} else {
+		for (int i = 0; i < thread_count; i++) {
+			pthread_create(&h.workers[i].thread, NULL, RunWorker, &h.workers[i]);
+		}
+		for (int i = 0; i < thread_count; i++) {
+			pthread_join(h.workers[i].thread, NULL);
+		}
+	}
+	if (!quiet) {
+		// The last update may have been throttled.
+		printf("\r%i", h.completed_runs);
+	}
+	if (h.failure_log) {
+		fclose(h.failure_log);
+		printf("\r\n%i failures logged to %s.", h.logged_failures, log_name);
+	}
+
+	// Merge the per-worker histograms.
+	Counts_def_struct totals;
+	if (AllocCounts(&totals, max_errors + 1) < 0) {
+		printf("\r\nCould not allocate counters.\r\n");
+		return(-1);
+	}
+	for (int i = 1; i < thread_count; i++) {
+		RS2StatsMerge(&h.workers[0].ws, &h.workers[i].ws);
+	}
+	if (print_stats) {
+		RS2StatsDump(stdout, &h.workers[0].ws);
+	}
+	for (int i = 0; i < thread_count; i++) {
+		MergeCounts(&totals, &h.workers[i].counts, max_errors + 1);
+		FreeCounts(&h.workers[i].counts);
+		FreeBuffers(&h.workers[i]);
+		FreeRS2Work(&h.workers[i].ws);
+		FreeRS2Pool(&h.workers[i].pool);
+		pthread_mutex_destroy(&h.workers[i].lock);
 	}
+	free(h.workers);
+	free(h.streams);
+	pthread_mutex_destroy(&h.print_lock);
+	int *successes = totals.successes;
+	int *decoder_indicated_failures = totals.decoder_indicated_failures;
+	int *failures = totals.failures;
+	int *undetected_failures = totals.undetected_failures;
+	int *artificial_codewords = totals.artificial_codewords;
 
 	printf("\r\nDecode Success by Error Count:");
 	for (int i = 0; i <= max_errors; i++) {
@@ -315,5 +798,8 @@ int main(int arg_count, char* arg_values[]) {
 	for (int i = 0; i <= max_errors; i++) {
 		printf("\r\n%i, %i", i, artificial_codewords[i]);
 	}
+	FreeCounts(&totals);
+	FreeRS2(&rs);
+	FreeGF2(&gf);
 	printf("\r\nDone.\r\n");
 }
\ No newline at end of file
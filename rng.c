@@ -0,0 +1,79 @@
+#include "rng.h"
+
+uint64_t rotl(uint64_t x, int k) {
+	return (x << k) | (x >> (64 - k));
+}
+
+void RNGSeed(uint64_t seed, RNG_def_struct *rng) {
+	// splitmix64 spreads any seed, including zero, over the whole state.
+	for (int i = 0; i < 4; i++) {
+		uint64_t z = (seed += 0x9e3779b97f4a7c15ULL);
+		z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+		z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+		rng->s[i] = z ^ (z >> 31);
+	}
+}
+
+uint64_t RNGNext(RNG_def_struct *rng) {
+	uint64_t *s = rng->s;
+	uint64_t result = rotl(s[1] * 5, 7) * 9;
+	uint64_t t = s[1] << 17;
+	s[2] ^= s[0];
+	s[3] ^= s[1];
+	s[1] ^= s[2];
+	s[0] ^= s[3];
+	s[2] ^= t;
+	s[3] = rotl(s[3], 45);
+	return result;
+}
+
+void RNGJump(RNG_def_struct *rng) {
+	static const uint64_t jump[] = { 0x180ec6d33cfd0abaULL, 0xd5a61266f0c9392cULL, 0xa9582618e03fc9aaULL, 0x39abdc4529b1661cULL };
+	uint64_t s0 = 0;
+	uint64_t s1 = 0;
+	uint64_t s2 = 0;
+	uint64_t s3 = 0;
+	for (int i = 0; i < 4; i++) {
+		for (int b = 0; b < 64; b++) {
+			if (jump[i] & (1ULL << b)) {
+				s0 ^= rng->s[0];
+				s1 ^= rng->s[1];
+				s2 ^= rng->s[2];
+				s3 ^= rng->s[3];
+			}
+			RNGNext(rng);
+		}
+	}
+	rng->s[0] = s0;
+	rng->s[1] = s1;
+	rng->s[2] = s2;
+	rng->s[3] = s3;
+}
+
+uint32_t RNGBounded(uint32_t range, RNG_def_struct *rng) {
+	// Lemire's multiply-shift, rejecting the few products that would bias
+	// the result.
+	uint64_t m = (RNGNext(rng) >> 32) * range;
+	uint32_t low = (uint32_t)m;
+	if (low < range) {
+		uint32_t threshold = -range % range;
+		while (low < threshold) {
+			m = (RNGNext(rng) >> 32) * range;
+			low = (uint32_t)m;
+		}
+	}
+	return (uint32_t)(m >> 32);
+}
+
+void RNGFillSymbols(uint16_t *buffer, int count, int bits, RNG_def_struct *rng) {
+	int per_draw = 64 / bits;
+	uint64_t mask = (1ULL << bits) - 1;
+	int i = 0;
+	while (i < count) {
+		uint64_t x = RNGNext(rng);
+		for (int j = 0; (j < per_draw) && (i < count); j++) {
+			buffer[i++] = x & mask;
+			x >>= bits;
+		}
+	}
+}
@@ -0,0 +1,44 @@
+/*
+ * File:   rng.h
+ *
+ * Created on October 17, 2026
+ */
+
+#ifndef RNG_H
+#define	RNG_H
+
+#include <stdint.h>
+
+// xoshiro256** state. Use one per stream; never share between threads.
+typedef struct {
+    uint64_t s[4];
+} RNG_def_struct;
+
+// RNGSeed
+// Initializes a generator from a 64-bit seed, expanded through splitmix64.
+// Arg1: seed
+void RNGSeed(uint64_t, RNG_def_struct*);
+
+// RNGNext
+// Returns the next 64 random bits.
+uint64_t RNGNext(RNG_def_struct*);
+
+// RNGJump
+// Advances the generator by 2^128 steps. Jumping a copy of a generator N times
+// gives N non-overlapping streams.
+void RNGJump(RNG_def_struct*);
+
+// RNGBounded
+// Returns a uniform random integer in the range 0 to Arg1 - 1.
+// Arg1: range, must be greater than zero
+uint32_t RNGBounded(uint32_t, RNG_def_struct*);
+
+// RNGFillSymbols
+// Fills a buffer with uniform random symbols of the given width, taking as
+// many symbols from each 64-bit draw as fit.
+// Arg1: pointer to buffer
+// Arg2: symbol count
+// Arg3: bits per symbol, 1 to 16
+void RNGFillSymbols(uint16_t*, int, int, RNG_def_struct*);
+
+#endif	/* RNG_H */
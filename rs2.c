@@ -1,282 +1,1345 @@
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
 #include "rs2.h"
 #include "gf2.h"
+#include "gf2_region.h"
+#include "rs2_fixed.h"
+#include "rs2_stats.h"
+#include "gf2_poly.h"
+#include "gf2_fft.h"
+#include "rs2_stages.h"
+#include "rs2_pool.h"
 
-void InitRS2(int first_root, int num_roots, RS2_def_struct *rs) {
-    rs->FirstRoot = first_root;
-    rs->NumRoots = num_roots;
-    rs->FieldOrder = GF2GetOrder(rs->GF);
+size_t table_size(const RS2_def_struct *rs, size_t symbol_size, size_t limit) {
+    // Bytes in a table of FieldOrder rows of NumRoots symbols, or 0 when
+    // that exceeds the limit and the table should not be built.
+    size_t size = (size_t)rs->FieldOrder * rs->NumRoots * symbol_size;
+    return (size <= limit) ? size : 0;
+}
+
+// Process-wide cache of built codes, keyed by field generator polynomial,
+// first root and root count. Entries own their tables until exit.
+RS2_def_struct rs2_cache[RS2_CACHE_SIZE];
+int rs2_cache_polys[RS2_CACHE_SIZE];
+int rs2_cache_count = 0;
+pthread_mutex_t rs2_cache_lock = PTHREAD_MUTEX_INITIALIZER;
+
+void share_rs2(const RS2_def_struct *from, RS2_def_struct *to) {
+    // Point a code at another's tables.
+    to->Genpoly = from->Genpoly;
+    to->EncodeTable8 = from->EncodeTable8;
+    to->EncodeTable16 = from->EncodeTable16;
+    to->SyndromeTable8 = from->SyndromeTable8;
+    to->MulRootTable16 = from->MulRootTable16;
+    to->FFT = from->FFT;
+    to->Fixed = from->Fixed;
+}
+
+int fft_pays(const RS2_def_struct *rs, int block_size, int terms, int cost) {
+    // Evaluating terms coefficients at block_size points directly, against
+    // one transform over the whole field.
+    long direct = (long)block_size * terms;
+    return direct > (long)cost * rs->FieldOrder * rs->GF->Power;
+}
+
+int build_rs2(RS2_def_struct *rs) {
     // Generate Reed Solomon generator polynomial through convolution of polynomials.
     // rs->GenPoly = (x + a^b)(x + a^b+1)...(x + a^b+r-1)
     // start with rs->GenPoly = x + a^b
     // lowest order coefficient in lowest index of array
 	// b represents the "first consecutive root" of generator polynomial.
-    rs->Genpoly[0] = GF2Pow(rs->FirstRoot, rs->GF);
+    int num_roots = rs->NumRoots;
+    rs->Genpoly = malloc(sizeof(GF2_elem_t) * (num_roots + 1));
+    if (rs->Genpoly == NULL) {
+        FreeRS2(rs);
+        return -1;
+    }
+    rs->Genpoly[0] = GF2Pow(GF2Mod(rs->FirstRoot, rs->GF), rs->GF);
     rs->Genpoly[1] = 1;
-    int factorpoly[2];
+    GF2_elem_t factorpoly[2];
     // preload the x^1 coefficient in the factor polynomial
     factorpoly[1] = 1;
     for (int i = 1; i < num_roots; i++) {
         factorpoly[0] = GF2Pow(GF2Mod(i + rs->FirstRoot, rs->GF), rs->GF);
-        GF2Conv(&rs->Genpoly[0], i + 1, &factorpoly[0], 2, rs->GF);
+        GF2PolyMul(rs->Genpoly, rs->Genpoly, i + 1, factorpoly, 2, rs->GF);
+    }
+    // Precompute the encoder product rows, so each message symbol costs one
+    // row lookup instead of NumRoots multiplies. Tables over RS2_TABLE_LIMIT
+    // are not built; then, or if allocation fails, the encoders fall back to
+    // GF2Mul.
+    if (table_size(rs, sizeof(uint16_t), RS2_TABLE_LIMIT)) {
+        rs->EncodeTable16 = malloc(table_size(rs, sizeof(uint16_t), RS2_TABLE_LIMIT));
+    }
+    if (rs->GF->Power <= 8) {
+        rs->EncodeTable8 = malloc(table_size(rs, sizeof(uint8_t), RS2_TABLE_LIMIT));
+    }
+    for (int x = 0; x < rs->FieldOrder; x++) {
+        for (int j = 0; j < num_roots; j++) {
+            int product = GF2Mul(x, rs->Genpoly[num_roots - 1 - j], rs->GF);
+            if (rs->EncodeTable16) {
+                rs->EncodeTable16[(x * num_roots) + j] = product;
+            }
+            if (rs->EncodeTable8) {
+                rs->EncodeTable8[(x * num_roots) + j] = product;
+            }
+        }
+    }
+    // Syndrome tables. MulRootTable16 row i multiplies any symbol by root i,
+    // a^(FirstRoot + i), for the one-pass Horner syndromes. SyndromeTable8
+    // row e holds every root raised to the power e, so a symbol at exponent
+    // e adds one region multiply-accumulate to all syndromes at once.
+    // Either may be NULL, and the decoder falls back to Horner on the log
+    // tables. Its random lookups only beat the log tables while it stays
+    // cache resident, hence the lower RS2_HORNER_TABLE_LIMIT.
+    int period = rs->FieldOrder - 1;
+    if (table_size(rs, sizeof(uint16_t), RS2_HORNER_TABLE_LIMIT)) {
+        rs->MulRootTable16 = malloc(table_size(rs, sizeof(uint16_t), RS2_HORNER_TABLE_LIMIT));
+    }
+    if (rs->MulRootTable16) {
+        for (int i = 0; i < num_roots; i++) {
+            int root = GF2Pow(GF2Mod(rs->FirstRoot + i, rs->GF), rs->GF);
+            for (int x = 0; x < rs->FieldOrder; x++) {
+                rs->MulRootTable16[(i * rs->FieldOrder) + x] = GF2Mul(x, root, rs->GF);
+            }
+        }
+    }
+    if (rs->GF->FastMul) {
+        rs->SyndromeTable8 = malloc(sizeof(uint8_t) * period * num_roots);
     }
+    if (rs->SyndromeTable8) {
+        for (int i = 0; i < num_roots; i++) {
+            int root_log = GF2Mod(rs->FirstRoot + i, rs->GF);
+            int power_log = 0;
+            for (int e = 0; e < period; e++) {
+                rs->SyndromeTable8[(e * num_roots) + i] = GF2Pow(power_log, rs->GF);
+                power_log += root_log;
+                if (power_log >= period) {
+                    power_log -= period;
+                }
+            }
+        }
+    }
+    // Additive FFT plan for the syndromes and Chien search of long blocks.
+    // Without it, or if allocation fails, both evaluate directly.
+    if ((rs->GF->Power > 8) && fft_pays(rs, period, num_roots, RS2_FFT_CHIEN_COST)) {
+        rs->FFT = malloc(sizeof(GF2_fft_struct));
+        if (rs->FFT && (InitGF2FFT(rs->GF, rs->FFT) < 0)) {
+            free(rs->FFT);
+            rs->FFT = NULL;
+        }
+    }
+    // Use a codec specialized at compile time when one matches.
+    rs->Fixed = RS2FindFixed(rs);
+    return 0;
 }
 
-void RSEncode(int *message, int message_size, RS2_def_struct *rs) {
+int InitRS2(int first_root, int num_roots, RS2_def_struct *rs) {
+    rs->FirstRoot = first_root;
+    rs->NumRoots = num_roots;
+    rs->FieldOrder = GF2GetOrder(rs->GF);
+    rs->Genpoly = NULL;
+    rs->EncodeTable8 = NULL;
+    rs->EncodeTable16 = NULL;
+    rs->SyndromeTable8 = NULL;
+    rs->MulRootTable16 = NULL;
+    rs->FFT = NULL;
+    rs->Fixed = NULL;
+    rs->Cached = 0;
+    if ((num_roots < 1) || (num_roots >= rs->FieldOrder - 1)) {
+        return -1;
+    }
+    // Reuse the tables of an identical code built earlier. Building under the
+    // lock keeps racing threads from building the same code twice.
+    pthread_mutex_lock(&rs2_cache_lock);
+    for (int i = 0; i < rs2_cache_count; i++) {
+        const RS2_def_struct *cached = &rs2_cache[i];
+        if ((rs2_cache_polys[i] == rs->GF->GenPoly) && (cached->FirstRoot == first_root) && (cached->NumRoots == num_roots)) {
+            share_rs2(cached, rs);
+            rs->Cached = 1;
+            pthread_mutex_unlock(&rs2_cache_lock);
+            return 0;
+        }
+    }
+    int status = build_rs2(rs);
+    if ((status == 0) && (rs2_cache_count < RS2_CACHE_SIZE)) {
+        rs2_cache[rs2_cache_count] = *rs;
+        rs2_cache[rs2_cache_count].GF = NULL;
+        rs2_cache_polys[rs2_cache_count] = rs->GF->GenPoly;
+        rs2_cache_count++;
+        rs->Cached = 1;
+    }
+    pthread_mutex_unlock(&rs2_cache_lock);
+    return status;
+}
+
+void FreeRS2(RS2_def_struct *rs) {
+    // Tables shared with the cache stay allocated.
+    if (!rs->Cached) {
+        free(rs->Genpoly);
+        free(rs->EncodeTable8);
+        free(rs->EncodeTable16);
+        free(rs->SyndromeTable8);
+        free(rs->MulRootTable16);
+        if (rs->FFT) {
+            FreeGF2FFT(rs->FFT);
+            free(rs->FFT);
+        }
+    }
+    rs->Genpoly = NULL;
+    rs->EncodeTable8 = NULL;
+    rs->EncodeTable16 = NULL;
+    rs->SyndromeTable8 = NULL;
+    rs->MulRootTable16 = NULL;
+    rs->FFT = NULL;
+    rs->Fixed = NULL;
+}
+
+int InitRS2Work(const RS2_def_struct *rs, RS2_work_struct *ws) {
+    // One allocation carved into the decoder scratch polynomials, each
+    // NumRoots + 1 symbols, plus three more for Berlekamp-Massey, and one of
+    // three int arrays for the syndrome and Chien registers and the Chien
+    // start offsets.
+    int size = rs->NumRoots + 1;
+    ws->Size = size;
+    ws->Pool = NULL;
+    ws->PoolChunks = 0;
+    ws->PoolSyndromes = NULL;
+    ws->PoolRegisters = NULL;
+    ws->Transform = NULL;
+    ws->Memory = malloc(sizeof(GF2_elem_t) * size * 10);
+    ws->Registers = malloc(sizeof(int) * size * 3);
+    ws->ErasureMarks = calloc((rs->FieldOrder + 7) / 8, sizeof(uint8_t));
+    if (rs->FFT) {
+        ws->Transform = malloc(sizeof(GF2_elem_t) * rs->FieldOrder * 2);
+    }
+    if ((ws->Memory == NULL) || (ws->Registers == NULL) || (ws->ErasureMarks == NULL) || (rs->FFT && (ws->Transform == NULL))) {
+        FreeRS2Work(ws);
+        return -1;
+    }
+    ws->Syndromes = &ws->Memory[0];
+    ws->SavedSyndromes = &ws->Memory[size];
+    ws->ErrorIndices = &ws->Memory[size * 2];
+    ws->ErrorMagPoly = &ws->Memory[size * 3];
+    ws->ErrorMags = &ws->Memory[size * 4];
+    ws->ErrorLocatorPoly = &ws->Memory[size * 5];
+    ws->ErrorLocatorRoots = &ws->Memory[size * 6];
+    ws->Scratch = &ws->Memory[size * 7];
+    ws->ChienStart = &ws->Registers[size * 2];
+    ws->ChienBlockSize = 0;
+    for (int i = 0; i < size * 10; i++) {
+        ws->Memory[i] = 0;
+    }
+    ws->BlockSize = 0;
+    ws->ErrorCount = 0;
+    ws->ErrorLocatorDegree = 0;
+    ws->Erasures = NULL;
+    ws->ErasureCount = 0;
+    RS2StatsReset(ws);
+    return 0;
+}
+
+void FreeRS2Work(RS2_work_struct *ws) {
+    free(ws->Memory);
+    free(ws->Registers);
+    free(ws->Transform);
+    free(ws->ErasureMarks);
+    ws->Memory = NULL;
+    ws->Registers = NULL;
+    ws->Transform = NULL;
+    ws->ErasureMarks = NULL;
+    RS2SetPool(ws, NULL);
+}
+
+int RS2SetPool(RS2_work_struct *ws, RS2_pool_struct *pool) {
+    // One chunk of the block per pool thread, each with its own partial
+    // syndromes and registers.
+    free(ws->PoolSyndromes);
+    free(ws->PoolRegisters);
+    ws->Pool = NULL;
+    ws->PoolChunks = 0;
+    ws->PoolSyndromes = NULL;
+    ws->PoolRegisters = NULL;
+    if ((pool == NULL) || (pool->ThreadCount < 2)) {
+        return 0;
+    }
+    int chunks = pool->ThreadCount;
+    ws->PoolSyndromes = malloc(sizeof(GF2_elem_t) * ws->Size * chunks);
+    ws->PoolRegisters = malloc(sizeof(int) * ((ws->Size * 3) + 1) * chunks);
+    if ((ws->PoolSyndromes == NULL) || (ws->PoolRegisters == NULL)) {
+        RS2SetPool(ws, NULL);
+        return -1;
+    }
+    ws->Pool = pool;
+    ws->PoolChunks = chunks;
+    return 0;
+}
+
+void xor_bytes(uint8_t *dst, const uint8_t *src, int count) {
+	// XOR src into dst a machine word at a time.
+	int i = 0;
+	for (; i + 8 <= count; i += 8) {
+		uint64_t d, s;
+		memcpy(&d, &dst[i], 8);
+		memcpy(&s, &src[i], 8);
+		d ^= s;
+		memcpy(&dst[i], &d, 8);
+	}
+	for (; i < count; i++) {
+		dst[i] ^= src[i];
+	}
+}
+
+int check_block_size(int block_size, const RS2_def_struct *rs) {
+	// A block holds at least one message symbol plus the parity, and at
+	// most FieldOrder - 1 symbols, one per nonzero field element. The
+	// scratch buffers and tables are sized to that limit.
+	if ((block_size < rs->NumRoots + 1) || (block_size > rs->FieldOrder - 1)) {
+		return -1;
+	}
+	return 0;
+}
+
+int RSEncode8(uint8_t *message, int message_size, const RS2_def_struct *rs) {
 	// Calculate Reed Solomon parity symbols.
 	// Parity symbols are appended after the message.
-	for (int i = 0; i < rs->NumRoots; i++) {
-		message[i + message_size] = 0;
+	// The parity register holds the remainder of the message polynomial
+	// divided by rs->Genpoly, highest power first.
+	uint8_t *parity = &message[message_size];
+	int num_roots = rs->NumRoots;
+	if ((rs->GF->Power > 8) || check_block_size(message_size + num_roots, rs)) {
+		return -1;
 	}
-	int quotient[MAX_GENPOLY_ROOTS + 1];
-	for (int i = 0; i < rs->NumRoots + 1; i++) {
-		quotient[i] = message[i];
+	if (rs->Fixed && (message_size == rs->Fixed->MessageSize)) {
+		rs->Fixed->Encode8(message);
+		return 0;
+	}
+	if (rs->EncodeTable8) {
+		// Long division in a scratch copy of the block. The register is the
+		// NumRoots symbols after the current one, so each message symbol
+		// costs one product row lookup and one vector XOR, with no shift.
+		uint8_t work[RS2_MAX_BLOCK8];
+		const uint8_t *table = rs->EncodeTable8;
+		int mask = rs->GF->Mask;
+		memcpy(work, message, message_size);
+		memset(&work[message_size], 0, num_roots);
+		for (int i = 0; i < message_size; i++) {
+			xor_bytes(&work[i + 1], &table[(work[i] & mask) * num_roots], num_roots);
+		}
+		memcpy(parity, &work[message_size], num_roots);
+		return 0;
+	}
+	for (int i = 0; i < num_roots; i++) {
+		parity[i] = 0;
+	}
+	for (int i = 0; i < message_size; i++) {
+		int x = message[i] ^ parity[0];
+		for (int j = 0; j < num_roots - 1; j++) {
+			parity[j] = parity[j + 1] ^ GF2Mul(x, rs->Genpoly[num_roots - 1 - j], rs->GF);
+		}
+		parity[num_roots - 1] = GF2Mul(x, rs->Genpoly[0], rs->GF);
+	}
+	return 0;
+}
+
+int RSEncode16(uint16_t *message, int message_size, const RS2_def_struct *rs) {
+	uint16_t *parity = &message[message_size];
+	int num_roots = rs->NumRoots;
+	if (check_block_size(message_size + num_roots, rs)) {
+		return -1;
+	}
+	if (rs->Fixed && (message_size == rs->Fixed->MessageSize)) {
+		rs->Fixed->Encode16(message);
+		return 0;
+	}
+	uint16_t *work = rs->EncodeTable16 ? malloc(sizeof(uint16_t) * (message_size + num_roots)) : NULL;
+	if (work) {
+		// The same division as RSEncode8, in heap scratch sized to the block,
+		// since a copy of the largest block would not fit the stack. Without
+		// the scratch the register below does the division.
+		const uint16_t *table = rs->EncodeTable16;
+		int mask = rs->GF->Mask;
+		memcpy(work, message, sizeof(uint16_t) * message_size);
+		memset(&work[message_size], 0, sizeof(uint16_t) * num_roots);
+		for (int i = 0; i < message_size; i++) {
+			xor_bytes((uint8_t*)&work[i + 1], (const uint8_t*)&table[(work[i] & mask) * num_roots], sizeof(uint16_t) * num_roots);
+		}
+		memcpy(parity, &work[message_size], sizeof(uint16_t) * num_roots);
+		free(work);
+		return 0;
+	}
+	for (int i = 0; i < num_roots; i++) {
+		parity[i] = 0;
 	}
 	for (int i = 0; i < message_size; i++) {
-		int x = quotient[0];
-		for (int j = 1; j < rs->NumRoots + 1; j++) {
-			quotient[j - 1] = GF2Mul(x, rs->Genpoly[rs->NumRoots - j], rs->GF) ^ quotient[j];
+		int x = message[i] ^ parity[0];
+		for (int j = 0; j < num_roots - 1; j++) {
+			parity[j] = parity[j + 1] ^ GF2Mul(x, rs->Genpoly[num_roots - 1 - j], rs->GF);
 		}
-		quotient[rs->NumRoots] = message[i + rs->NumRoots + 1];
+		parity[num_roots - 1] = GF2Mul(x, rs->Genpoly[0], rs->GF);
+	}
+	return 0;
+}
+
+int RSEncode(int *message, int message_size, const RS2_def_struct *rs) {
+	// Widen/narrow through the halfword encoder, in heap scratch sized to
+	// the block.
+	if (check_block_size(message_size + rs->NumRoots, rs)) {
+		return -1;
+	}
+	uint16_t *block = malloc(sizeof(uint16_t) * (message_size + rs->NumRoots));
+	if (block == NULL) {
+		return -1;
+	}
+	for (int i = 0; i < message_size; i++) {
+		block[i] = message[i];
 	}
+	RSEncode16(block, message_size, rs);
 	for (int i = 0; i < rs->NumRoots; i++) {
-		message[i + message_size] = quotient[i];
+		message[i + message_size] = block[i + message_size];
 	}
+	free(block);
+	return 0;
 }
 
-int calc_syndromes(RS2_def_struct *rs) {
-	// Calculate one syndrome for each root of rs->GenPoly.
-	// Each syndrome is the evaluation of the message polynomial at a root of rs->GenPoly
+int count_syndromes(const RS2_def_struct *rs, RS2_work_struct *ws) {
 	int nonzero = 0; // Count how many non-zero syndromes are calculated.
 	for (int i = 0; i < rs->NumRoots; i++) {
-		rs->Syndromes[i] = 0;
-        int gp_root = GF2Pow(GF2Mod(rs->FirstRoot + i, rs->GF), rs->GF);
-		for (int j = 0; j < rs->BlockSize - 1; j++) {
-			rs->Syndromes[i] = GF2Mul(rs->Syndromes[i] ^ rs->DataBlock[j], gp_root, rs->GF);
-		}
-		rs->Syndromes[i] = rs->Syndromes[i] ^ rs->DataBlock[rs->BlockSize - 1];
-		if (rs->Syndromes[i]) {
-			nonzero++;// Count how many non-zero syndromes are calculated.
+		if (ws->Syndromes[i]) {
+			nonzero++;
 		}
 	}
 	return nonzero;
 }
 
-int calc_syndromes2(RS2_def_struct *rs) {
-	// Calculate one syndrome for each root of rs->GenPoly.
-	// Each syndrome is the evaluation of the message polynomial at a root of rs->GenPoly
-	int nonzero = 0; // Count how many non-zero syndromes are calculated.
+// Syndromes in one pass over the data block. Each syndrome is the evaluation
+// of the message polynomial at a root of rs->GenPoly. With SyndromeTable8,
+// symbol j at exponent e = BlockSize - 1 - j is multiplied into row e of root
+// powers and accumulated into all syndromes with one region kernel call.
+// Otherwise every symbol steps each syndrome's Horner register through its
+// MulRootTable16 row. The generic body is shared by the 8 and 16 bit data
+// paths.
+#define RS2_SYNDROMES_BODY(rs, ws, data) \
+	int num_roots = rs->NumRoots; \
+	int block_size = ws->BlockSize; \
+	int mask = rs->GF->Mask; \
+	if (rs->SyndromeTable8 && (num_roots >= RS2_SYNDROME_ROWS_MIN)) { \
+		uint8_t acc[RS2_MAX_ROOTS8]; \
+		memset(acc, 0, num_roots); \
+		for (int j = 0; j < block_size; j++) { \
+			if (data[j]) { \
+				GF2MulAddRegion(acc, &rs->SyndromeTable8[(block_size - 1 - j) * num_roots], data[j] & mask, num_roots, rs->GF); \
+			} \
+		} \
+		for (int i = 0; i < num_roots; i++) { \
+			ws->Syndromes[i] = acc[i]; \
+		} \
+	} else if (rs->MulRootTable16) { \
+		int order = rs->FieldOrder; \
+		int *acc = ws->Registers; \
+		for (int i = 0; i < num_roots; i++) { \
+			acc[i] = 0; \
+		} \
+		for (int j = 0; j < block_size - 1; j++) { \
+			int symbol = data[j] & mask; \
+			const uint16_t *row = rs->MulRootTable16; \
+			for (int i = 0; i < num_roots; i++) { \
+				acc[i] = row[acc[i] ^ symbol]; \
+				row += order; \
+			} \
+		} \
+		for (int i = 0; i < num_roots; i++) { \
+			ws->Syndromes[i] = acc[i] ^ (data[block_size - 1] & mask); \
+		} \
+	} else { \
+		/* Horner in the log domain, on the field tables alone. */ \
+		const GF2_elem_t *table = rs->GF->Table; \
+		const GF2_elem_t *index = rs->GF->Index; \
+		int *acc = ws->Registers; \
+		int *root_log = &ws->Registers[ws->Size]; \
+		for (int i = 0; i < num_roots; i++) { \
+			acc[i] = 0; \
+			root_log[i] = GF2Mod(rs->FirstRoot + i, rs->GF); \
+		} \
+		for (int j = 0; j < block_size - 1; j++) { \
+			int symbol = data[j] & mask; \
+			for (int i = 0; i < num_roots; i++) { \
+				int x = acc[i] ^ symbol; \
+				acc[i] = x ? table[index[x] + root_log[i]] : 0; \
+			} \
+		} \
+		for (int i = 0; i < num_roots; i++) { \
+			ws->Syndromes[i] = acc[i] ^ (data[block_size - 1] & mask); \
+		} \
+	} \
+	return count_syndromes(rs, ws);
+
+// Shared state of a decode stage split across a workspace's pool.
+typedef struct {
+	const RS2_def_struct *rs;
+	RS2_work_struct *ws;
+	const uint16_t *data;
+	int degree;
+} RS2_pool_job_struct;
+
+int pool_chunk_start(const RS2_work_struct *ws, int chunk) {
+	return (int)(((long)ws->BlockSize * chunk) / ws->PoolChunks);
+}
+
+void syndromes_chunk(void *arg, int chunk) {
+	// Horner over positions [a, b) gives sum r_j * root^(b - 1 - j); scaling
+	// by root^(BlockSize - b) moves it to the chunk's place in the block, so
+	// the chunks' partial syndromes add up to the whole.
+	const RS2_pool_job_struct *job = arg;
+	const RS2_def_struct *rs = job->rs;
+	RS2_work_struct *ws = job->ws;
+	const GF2_elem_t *table = rs->GF->Table;
+	const GF2_elem_t *index = rs->GF->Index;
+	int num_roots = rs->NumRoots;
+	int period = rs->FieldOrder - 1;
+	int mask = rs->GF->Mask;
+	int a = pool_chunk_start(ws, chunk);
+	int b = pool_chunk_start(ws, chunk + 1);
+	int *acc = &ws->PoolRegisters[((ws->Size * 3) + 1) * chunk];
+	int *root_log = &acc[ws->Size];
+	GF2_elem_t *partial = &ws->PoolSyndromes[ws->Size * chunk];
+	for (int i = 0; i < num_roots; i++) {
+		acc[i] = 0;
+		root_log[i] = GF2Mod(rs->FirstRoot + i, rs->GF);
+	}
+	if (a == b) {
+		memset(partial, 0, sizeof(GF2_elem_t) * num_roots);
+		return;
+	}
+	for (int j = a; j < b - 1; j++) {
+		int symbol = job->data[j] & mask;
+		if (rs->MulRootTable16) {
+			const uint16_t *row = rs->MulRootTable16;
+			for (int i = 0; i < num_roots; i++) {
+				acc[i] = row[acc[i] ^ symbol];
+				row += rs->FieldOrder;
+			}
+		} else {
+			for (int i = 0; i < num_roots; i++) {
+				int x = acc[i] ^ symbol;
+				acc[i] = x ? table[index[x] + root_log[i]] : 0;
+			}
+		}
+	}
+	int shift = ws->BlockSize - b;
+	for (int i = 0; i < num_roots; i++) {
+		int x = acc[i] ^ (job->data[b - 1] & mask);
+		partial[i] = x ? GF2Pow((index[x] + (int)(((long)root_log[i] * shift) % period)) % period, rs->GF) : 0;
+	}
+}
+
+int calc_syndromes_pool(const RS2_def_struct *rs, RS2_work_struct *ws, const uint16_t *data) {
+	RS2_pool_job_struct job = {rs, ws, data, 0};
+	RS2PoolRun(ws->Pool, syndromes_chunk, &job, ws->PoolChunks);
 	for (int i = 0; i < rs->NumRoots; i++) {
-		rs->Syndromes[i] = 0;
-        int gp_root = GF2Mod(rs->FirstRoot + i, rs->GF);
-        int exponent = rs->BlockSize - 1;
-		for (int j = 0; j < rs->BlockSize - 1; j++) {
-			rs->Syndromes[i] ^= GF2Mul(rs->DataBlock[j], GF2Pow(GF2Mod(gp_root * exponent, rs->GF), rs->GF), rs->GF);
-			exponent--;
+		int syndrome = 0;
+		for (int c = 0; c < ws->PoolChunks; c++) {
+			syndrome ^= ws->PoolSyndromes[(ws->Size * c) + i];
 		}
-		rs->Syndromes[i] = rs->Syndromes[i] ^ rs->DataBlock[rs->BlockSize - 1];
-		if (rs->Syndromes[i]) {
-			nonzero++;// Count how many non-zero syndromes are calculated.
+		ws->Syndromes[i] = syndrome;
+	}
+	return count_syndromes(rs, ws);
+}
+
+int calc_syndromes_fft(const RS2_def_struct *rs, RS2_work_struct *ws, const uint16_t *data) {
+	// The received polynomial has data[0] as its highest coefficient. One
+	// transform evaluates it at every field element, and the syndromes are
+	// its values at the roots.
+	GF2_elem_t *values = ws->Transform;
+	int n = ws->BlockSize;
+	for (int k = 0; k < n; k++) {
+		values[k] = data[n - 1 - k] & rs->GF->Mask;
+	}
+	memset(&values[n], 0, sizeof(GF2_elem_t) * (rs->FieldOrder - n));
+	GF2FFT(rs->FFT, values, &values[rs->FieldOrder], rs->GF);
+	for (int i = 0; i < rs->NumRoots; i++) {
+		ws->Syndromes[i] = values[GF2Pow(GF2Mod(rs->FirstRoot + i, rs->GF), rs->GF)];
+	}
+	return count_syndromes(rs, ws);
+}
+
+int calc_syndromes8(const RS2_def_struct *rs, RS2_work_struct *ws, const uint8_t *data) {
+	// Calculate one syndrome for each root of rs->GenPoly.
+	if (rs->Fixed && rs->Fixed->Syndromes8 && (ws->BlockSize == rs->Fixed->BlockSize)) {
+		return rs->Fixed->Syndromes8(data, ws->Syndromes);
+	}
+	RS2_SYNDROMES_BODY(rs, ws, data)
+}
+
+int calc_syndromes16(const RS2_def_struct *rs, RS2_work_struct *ws, const uint16_t *data) {
+	if (rs->Fixed && rs->Fixed->Syndromes16 && (ws->BlockSize == rs->Fixed->BlockSize)) {
+		return rs->Fixed->Syndromes16(data, ws->Syndromes);
+	}
+	if (ws->Transform && fft_pays(rs, ws->BlockSize, rs->NumRoots, RS2_FFT_SYNDROME_COST)) {
+		return calc_syndromes_fft(rs, ws, data);
+	}
+	if (ws->Pool && (ws->BlockSize >= RS2_PARALLEL_MIN_BLOCK)) {
+		return calc_syndromes_pool(rs, ws, data);
+	}
+	RS2_SYNDROMES_BODY(rs, ws, data)
+}
+
+int update_syndromes(const RS2_def_struct *rs, RS2_work_struct *ws) {
+	// Syndromes are linear in the data, so the syndromes of the corrected
+	// block are the received syndromes plus those of the corrections. Each
+	// correction of magnitude e at exponent x adds e * (a^(FirstRoot + i))^x
+	// to syndrome i. This costs ErrorCount * NumRoots instead of a pass over
+	// the block.
+	int num_roots = rs->NumRoots;
+	int period = rs->FieldOrder - 1;
+	for (int k = 0; k < ws->ErrorCount; k++) {
+		int exponent = ws->BlockSize - 1 - ws->ErrorIndices[k];
+		int magnitude = ws->ErrorMags[k];
+		if (rs->SyndromeTable8 && (num_roots >= RS2_SYNDROME_ROWS_MIN)) {
+			uint8_t acc[RS2_MAX_ROOTS8];
+			for (int i = 0; i < num_roots; i++) {
+				acc[i] = ws->Syndromes[i];
+			}
+			GF2MulAddRegion(acc, &rs->SyndromeTable8[exponent * num_roots], magnitude, num_roots, rs->GF);
+			for (int i = 0; i < num_roots; i++) {
+				ws->Syndromes[i] = acc[i];
+			}
+		} else {
+			for (int i = 0; i < num_roots; i++) {
+				int root_log = GF2Mod(rs->FirstRoot + i, rs->GF);
+				int power = GF2Pow((int)(((long)root_log * exponent) % period), rs->GF);
+				ws->Syndromes[i] ^= GF2Mul(magnitude, power, rs->GF);
+			}
 		}
 	}
-	return nonzero;
+	return count_syndromes(rs, ws);
 }
 
-void save_syndromes(RS2_def_struct *rs) {
+void save_syndromes(const RS2_def_struct *rs, RS2_work_struct *ws) {
 	for (int i = 0; i < rs->NumRoots; i++) {
-		rs->SavedSyndromes[i] = rs->Syndromes[i];
+		ws->SavedSyndromes[i] = ws->Syndromes[i];
 	}
 }
 
-void calc_berlekamp2(RS2_def_struct *rs) {
-	int B[MAX_GENPOLY_ROOTS];
-	int T[MAX_GENPOLY_ROOTS];
-	for (int i = 0; i < MAX_GENPOLY_ROOTS; i++) {
-		rs->ErrorLocatorPoly[i] = 0;
-		B[i] = 0;
-		T[i] = 0;
+void calc_berlekamp2(const RS2_def_struct *rs, RS2_work_struct *ws) {
+	// Inversionless Berlekamp-Massey. Each discrepancy d updates the locator
+	// as Lambda = g * Lambda + d * x^m * B, where g is the discrepancy at the
+	// last length change, so no inverse is needed inside the loop. Loops run
+	// to the current polynomial degrees, and the three buffers rotate by
+	// pointer instead of being copied.
+	// With f erasures, Lambda and B start as the erasure locator
+	// Gamma = (1 + X1 x)(1 + X2 x)...(1 + Xf x), L starts at f and the
+	// iteration starts at syndrome f.
+	GF2_elem_t *lambda = &ws->Scratch[0];
+	GF2_elem_t *B = &ws->Scratch[ws->Size];
+	GF2_elem_t *T = &ws->Scratch[ws->Size * 2];
+	int f = ws->ErasureCount;
+	int period = rs->FieldOrder - 1;
+	GF2_elem_t factor[2] = {1, 0};
+	lambda[0] = 1;
+	for (int k = 0; k < f; k++) {
+		factor[1] = GF2Pow((ws->BlockSize - 1 - ws->Erasures[k]) % period, rs->GF);
+		GF2PolyMul(lambda, lambda, k + 1, factor, 2, rs->GF);
 	}
-	rs->ErrorLocatorPoly[0] = 1;
-	B[0] = 1;
-	int L = 0;
+	for (int i = 0; i <= f; i++) {
+		B[i] = lambda[i];
+	}
+	int lambda_degree = f;
+	int B_degree = f;
+	int L = f;
 	int m = 1;
-	int b = 1;
+	int g = 1;
 
-	for (int n = 0; n < rs->NumRoots; n++) {
+	for (int n = f; n < rs->NumRoots; n++) {
 		// Calculate discrepancy
-		int d = rs->Syndromes[n];
-		for (int i = 1; i <= L; i++) {
-			d ^= GF2Mul(rs->ErrorLocatorPoly[i], rs->Syndromes[n - i], rs->GF);
+		int d = 0;
+		for (int i = 0; (i <= lambda_degree) && (i <= n); i++) {
+			d ^= GF2Mul(lambda[i], ws->Syndromes[n - i], rs->GF);
 		}
 		if (d == 0) {
 			m++;
-		} else if ((2 * L) <= n) {
-			for (int i = 0; i < rs->NumRoots; i++) {
-				T[i] = rs->ErrorLocatorPoly[i];
-			}
-			for (int i = m; i < rs->NumRoots; i++) {
-				rs->ErrorLocatorPoly[i] ^= GF2Mul(GF2Mul(d, GF2Inv(b, rs->GF), rs->GF), B[i - m], rs->GF);
+			continue;
+		}
+		int T_degree = lambda_degree;
+		if (B_degree + m > T_degree) {
+			T_degree = B_degree + m;
+		}
+		for (int i = 0; i <= T_degree; i++) {
+			T[i] = 0;
+			if (i <= lambda_degree) {
+				T[i] = GF2Mul(g, lambda[i], rs->GF);
 			}
-			L = (n + 1) - L;
-			for (int i = 0; i < rs->NumRoots; i++) {
-				B[i] = T[i];
+			if ((i >= m) && (i - m <= B_degree)) {
+				T[i] ^= GF2Mul(d, B[i - m], rs->GF);
 			}
-			b = d;
+		}
+		GF2_elem_t *spare;
+		if ((2 * L) <= n + f) {
+			// Length change, the old locator becomes the correction term.
+			spare = B;
+			B = lambda;
+			B_degree = lambda_degree;
+			L = (n + 1 + f) - L;
+			g = d;
 			m = 1;
 		} else {
-			for (int i = m; i < rs->NumRoots; i++) {
-				rs->ErrorLocatorPoly[i] ^= GF2Mul(GF2Mul(d, GF2Inv(b, rs->GF), rs->GF), B[i - m], rs->GF);
-			}
+			spare = lambda;
 			m++;
 		}
+		lambda = T;
+		lambda_degree = T_degree;
+		T = spare;
 	}
+
+	// Normalize so Lambda(0) = 1, and hand back the locator zero filled to
+	// degree L.
+	int scale = GF2Inv(lambda[0], rs->GF);
+	for (int i = 0; i <= L; i++) {
+		ws->ErrorLocatorPoly[i] = 0;
+		if (i <= lambda_degree) {
+			ws->ErrorLocatorPoly[i] = GF2Mul(scale, lambda[i], rs->GF);
+		}
+	}
+	ws->ErrorLocatorDegree = L;
+
+	// Error evaluator polynomial, Omega = Lambda * S mod x^L.
+	GF2PolyMulTrunc(ws->ErrorMagPoly, ws->Syndromes, L, ws->ErrorLocatorPoly, L + 1, L, rs->GF);
 }
 
-int calc_chien(RS2_def_struct *rs) {
-	// Calculate error locations and error count from error locator polynomial.
-	// Brute force search for roots of error locator polynomial. Solutions
-	// found when polynomial evaluates to zero.
-	rs->ErrorCount = 0;
-	// Step through each index position in the code block
-	for (int candidate_location = 0; candidate_location < rs->BlockSize; candidate_location++) {
-		int evaluation = rs->ErrorLocatorPoly[0];
-		// account for code shortening by modifying candidate_root based on block size and field order:
-		int candidate_root = (candidate_location + rs->FieldOrder) - rs->BlockSize;  
-		for (int i = 1; i <= rs->NumRoots/2; i++) {
-			if (rs->ErrorLocatorPoly[i]) {
-				// Calculate power by multiplying exponents, then multiply by adding exponents:
-				int x = (candidate_root * i) + GF2Log(rs->ErrorLocatorPoly[i], rs->GF);
-				// Sum the evaluation, xor is addition in GF
-				evaluation ^= GF2Pow(GF2Mod(x, rs->GF), rs->GF);
+int locator_degree(const RS2_def_struct *rs, const RS2_work_struct *ws) {
+	// Degree of the error locator polynomial, searched no higher than the
+	// correctable limit (NumRoots + ErasureCount) / 2.
+	int degree = ws->ErrorLocatorDegree;
+	if (degree > (rs->NumRoots + ws->ErasureCount) / 2) {
+		degree = (rs->NumRoots + ws->ErasureCount) / 2;
+	}
+	while ((degree > 0) && (ws->ErrorLocatorPoly[degree] == 0)) {
+		degree--;
+	}
+	return degree;
+}
+
+const int *chien_start(const RS2_def_struct *rs, RS2_work_struct *ws) {
+	// A shortened code's block is the tail of a full length codeword whose
+	// leading FieldOrder - 1 - BlockSize symbols are implicit zeros, so the
+	// search starts at root FieldOrder - BlockSize and never visits the zero
+	// prefix. The start offset of each locator term only depends on the
+	// block size; keep it across decodes.
+	if (ws->ChienBlockSize != ws->BlockSize) {
+		int period = rs->FieldOrder - 1;
+		int first_root = rs->FieldOrder - ws->BlockSize;
+		int offset = 0;
+		for (int i = 0; i < ws->Size; i++) {
+			ws->ChienStart[i] = offset;
+			offset += first_root;
+			if (offset >= period) {
+				offset -= period;
+			}
+		}
+		ws->ChienBlockSize = ws->BlockSize;
+	}
+	return ws->ChienStart;
+}
+
+void chien_found(RS2_work_struct *ws, int candidate_location, int candidate_root) {
+	ws->ErrorIndices[ws->ErrorCount] = candidate_location;
+	ws->ErrorLocatorRoots[ws->ErrorCount] = candidate_root;
+	ws->ErrorCount++;
+}
+
+int calc_chien_scalar(const RS2_def_struct *rs, RS2_work_struct *ws, int degree) {
+	// One register per nonzero locator term, held as a log. Stepping to the
+	// next candidate root multiplies term i by a^i, which in the log domain
+	// is one add and one conditional subtract.
+	int period = rs->FieldOrder - 1;
+	int first_root = rs->FieldOrder - ws->BlockSize;
+	const int *start = chien_start(rs, ws);
+	int *term_log = &ws->Registers[0];
+	int *term_step = &ws->Registers[ws->Size];
+	int terms = 0;
+	for (int i = 1; i <= degree; i++) {
+		if (ws->ErrorLocatorPoly[i]) {
+			term_step[terms] = i % period;
+			term_log[terms] = GF2Log(ws->ErrorLocatorPoly[i], rs->GF) + start[i];
+			if (term_log[terms] >= period) {
+				term_log[terms] -= period;
+			}
+			terms++;
+		}
+	}
+	for (int candidate_location = 0; candidate_location < ws->BlockSize; candidate_location++) {
+		int evaluation = ws->ErrorLocatorPoly[0];
+		for (int j = 0; j < terms; j++) {
+			evaluation ^= GF2Pow(term_log[j], rs->GF);
+			term_log[j] += term_step[j];
+			if (term_log[j] >= period) {
+				term_log[j] -= period;
 			}
 		}
 		// If evaluation is zero, we have found a root of the error locator polynomial.
 		if (evaluation == 0) {
-			rs->ErrorIndices[rs->ErrorCount] = candidate_location;
-			rs->ErrorLocatorRoots[rs->ErrorCount] = candidate_root;
-			rs->ErrorCount++;
-            // Todo: check for an ambiguous solutions
+			chien_found(ws, candidate_location, first_root + candidate_location);
+			if (ws->ErrorCount == degree) {
+				// A degree L polynomial has at most L roots.
+				break;
+			}
 		}
 	}
-	return rs->ErrorCount;
+	return ws->ErrorCount;
 }
 
-void calc_error_value_poly(RS2_def_struct *rs) {
-	for (int i = 0; i < rs->ErrorCount; i++) {
-		rs->ErrorMagPoly[i] = rs->Syndromes[i];
-		for (int j = 1; j <= i; j++) {
-			rs->ErrorMagPoly[i] ^= GF2Mul(rs->Syndromes[i - j], rs->ErrorLocatorPoly[j], rs->GF);
+int calc_chien_lanes(const RS2_def_struct *rs, RS2_work_struct *ws, int degree) {
+	// Evaluates RS2_CHIEN_LANES consecutive candidates at once. Lane w of
+	// register row i holds term i at candidate (block start + w); advancing a
+	// whole block multiplies row i by the constant a^(i * RS2_CHIEN_LANES),
+	// one region multiply per term. Fields of 8 bits or less.
+	uint8_t rows[RS2_MAX_ROOTS8 * RS2_CHIEN_LANES];
+	int row_step[RS2_MAX_ROOTS8];
+	uint8_t evaluation[RS2_CHIEN_LANES];
+	int period = rs->FieldOrder - 1;
+	int first_root = rs->FieldOrder - ws->BlockSize;
+	const int *start = chien_start(rs, ws);
+	int terms = 0;
+	for (int i = 1; i <= degree; i++) {
+		if (ws->ErrorLocatorPoly[i]) {
+			uint8_t *row = &rows[terms * RS2_CHIEN_LANES];
+			int step = i % period;
+			int term_log = GF2Log(ws->ErrorLocatorPoly[i], rs->GF) + start[i];
+			if (term_log >= period) {
+				term_log -= period;
+			}
+			for (int w = 0; w < RS2_CHIEN_LANES; w++) {
+				row[w] = GF2Pow(term_log, rs->GF);
+				term_log += step;
+				if (term_log >= period) {
+					term_log -= period;
+				}
+			}
+			row_step[terms] = GF2Pow((i * RS2_CHIEN_LANES) % period, rs->GF);
+			terms++;
 		}
 	}
+	for (int base = 0; base < ws->BlockSize; base += RS2_CHIEN_LANES) {
+		memset(evaluation, ws->ErrorLocatorPoly[0], RS2_CHIEN_LANES);
+		for (int j = 0; j < terms; j++) {
+			xor_bytes(evaluation, &rows[j * RS2_CHIEN_LANES], RS2_CHIEN_LANES);
+		}
+		int lanes = ws->BlockSize - base;
+		if (lanes > RS2_CHIEN_LANES) {
+			lanes = RS2_CHIEN_LANES;
+		}
+		for (int w = 0; w < lanes; w++) {
+			if (evaluation[w] == 0) {
+				chien_found(ws, base + w, first_root + base + w);
+				if (ws->ErrorCount == degree) {
+					return ws->ErrorCount;
+				}
+			}
+		}
+		for (int j = 0; j < terms; j++) {
+			uint8_t *row = &rows[j * RS2_CHIEN_LANES];
+			GF2MulRegion(row, row, row_step[j], RS2_CHIEN_LANES, rs->GF);
+		}
+	}
+	return ws->ErrorCount;
 }
 
-void calc_forney(RS2_def_struct *rs) {
-	// Forney algorithm to determine error values
-	int denominator, numerator;
-	for (int i = 0; i < rs->ErrorCount; i++) {
-		// compute an error value for each error location
-		// Divide the error value polynomial by the derivitave of the error locator polynomial,
-		// both evaluated at the root of the error locator polynomial corresponding to the error location.
-		numerator = rs->ErrorMagPoly[0];
-		for (int j = 1; j < rs->ErrorCount; j++) { // calculate numerator
-			numerator ^= GF2Mul(rs->ErrorMagPoly[j], GF2Pow(GF2Mod(rs->ErrorLocatorRoots[i] * j, rs->GF), rs->GF), rs->GF);
-		}
-		// Apply adjustment for first consecutive root:
-		numerator = GF2Mul(numerator, GF2Pow(GF2Mod((1 - rs->FirstRoot)*(-rs->ErrorLocatorRoots[i]), rs->GF), rs->GF), rs->GF);
-		
-		denominator = rs->ErrorLocatorPoly[1];
-		for (int j = 3; j <= rs->NumRoots / 2; j += 2) {
-			denominator ^= GF2Mul(rs->ErrorLocatorPoly[j], GF2Pow(GF2Mod(rs->ErrorLocatorRoots[i] * (j - 1), rs->GF), rs->GF), rs->GF);
+void chien_chunk(void *arg, int chunk) {
+	// The scalar search over candidate positions [a, b), with each term's
+	// register advanced a steps from the block start. Roots go to the
+	// chunk's own list, at most degree of them.
+	const RS2_pool_job_struct *job = arg;
+	const RS2_def_struct *rs = job->rs;
+	RS2_work_struct *ws = job->ws;
+	int period = rs->FieldOrder - 1;
+	int a = pool_chunk_start(ws, chunk);
+	int b = pool_chunk_start(ws, chunk + 1);
+	int *term_log = &ws->PoolRegisters[((ws->Size * 3) + 1) * chunk];
+	int *term_step = &term_log[ws->Size];
+	int *found = &term_log[ws->Size * 2];
+	int *found_count = &term_log[ws->Size * 3];
+	int terms = 0;
+	for (int i = 1; i <= job->degree; i++) {
+		if (ws->ErrorLocatorPoly[i]) {
+			term_step[terms] = i % period;
+			term_log[terms] = (GF2Log(ws->ErrorLocatorPoly[i], rs->GF) + ws->ChienStart[i] + (int)(((long)i * a) % period)) % period;
+			terms++;
+		}
+	}
+	*found_count = 0;
+	for (int candidate_location = a; candidate_location < b; candidate_location++) {
+		int evaluation = ws->ErrorLocatorPoly[0];
+		for (int j = 0; j < terms; j++) {
+			evaluation ^= GF2Pow(term_log[j], rs->GF);
+			term_log[j] += term_step[j];
+			if (term_log[j] >= period) {
+				term_log[j] -= period;
+			}
+		}
+		if (evaluation == 0) {
+			found[(*found_count)++] = candidate_location;
+			if (*found_count == job->degree) {
+				break;
+			}
+		}
+	}
+}
+
+int calc_chien_pool(const RS2_def_struct *rs, RS2_work_struct *ws, int degree) {
+	RS2_pool_job_struct job = {rs, ws, NULL, degree};
+	int first_root = rs->FieldOrder - ws->BlockSize;
+	chien_start(rs, ws); // build the offsets before the threads read them
+	RS2PoolRun(ws->Pool, chien_chunk, &job, ws->PoolChunks);
+	// Chunks are in block order, so the merged list is too. A degree L
+	// polynomial has at most L roots in all.
+	for (int c = 0; c < ws->PoolChunks; c++) {
+		const int *found = &ws->PoolRegisters[(((ws->Size * 3) + 1) * c) + (ws->Size * 2)];
+		int count = found[ws->Size];
+		for (int k = 0; (k < count) && (ws->ErrorCount < degree); k++) {
+			chien_found(ws, found[k], first_root + found[k]);
+		}
+	}
+	return ws->ErrorCount;
+}
+
+int calc_chien_fft(const RS2_def_struct *rs, RS2_work_struct *ws, int degree) {
+	// Evaluate the locator at every field element by transform, then look
+	// up the candidate roots in block order.
+	GF2_elem_t *values = ws->Transform;
+	int first_root = rs->FieldOrder - ws->BlockSize;
+	for (int i = 0; i <= degree; i++) {
+		values[i] = ws->ErrorLocatorPoly[i];
+	}
+	memset(&values[degree + 1], 0, sizeof(GF2_elem_t) * (rs->FieldOrder - degree - 1));
+	GF2FFT(rs->FFT, values, &values[rs->FieldOrder], rs->GF);
+	for (int candidate_location = 0; candidate_location < ws->BlockSize; candidate_location++) {
+		if (values[GF2Pow(first_root + candidate_location, rs->GF)] == 0) {
+			chien_found(ws, candidate_location, first_root + candidate_location);
+			if (ws->ErrorCount == degree) {
+				break;
+			}
 		}
+	}
+	return ws->ErrorCount;
+}
+
+int calc_chien(const RS2_def_struct *rs, RS2_work_struct *ws) {
+	// Calculate error locations and error count from error locator polynomial.
+	// Search every position of the code block for roots of the error locator
+	// polynomial. Solutions found when polynomial evaluates to zero.
+	// Account for code shortening by offsetting candidate_root by the
+	// difference of field order and block size.
+	ws->ErrorCount = 0;
+	int degree = locator_degree(rs, ws);
+	if (degree == 0) {
+		// A nonzero constant has no roots.
+		return 0;
+	}
+	if (ws->Transform && fft_pays(rs, ws->BlockSize, degree, RS2_FFT_CHIEN_COST)) {
+		return calc_chien_fft(rs, ws, degree);
+	}
+	if (ws->Pool && (ws->BlockSize >= RS2_PARALLEL_MIN_BLOCK)) {
+		return calc_chien_pool(rs, ws, degree);
+	}
+	if (rs->GF->FastMul && (ws->BlockSize >= RS2_CHIEN_LANES)) {
+		return calc_chien_lanes(rs, ws, degree);
+	}
+	return calc_chien_scalar(rs, ws, degree);
+}
+
+void calc_forney(const RS2_def_struct *rs, RS2_work_struct *ws) {
+	// Forney algorithm to determine error values
+	// Divide the error value polynomial by the derivitave of the error locator polynomial,
+	// both evaluated at the root of the error locator polynomial corresponding to the error location.
+	// The roots are held as logs, so both evaluations are table adds.
+	GF2_elem_t *derivative = &ws->Scratch[0];
+	GF2_elem_t *denominators = &ws->Scratch[ws->Size];
+	int derivative_size = GF2PolyDeriv(derivative, ws->ErrorLocatorPoly, ws->ErrorLocatorDegree + 1);
+	GF2PolyEvalMany(ws->ErrorMags, ws->ErrorMagPoly, ws->ErrorLocatorDegree, ws->ErrorLocatorRoots, ws->ErrorCount, rs->GF);
+	GF2PolyEvalMany(denominators, derivative, derivative_size, ws->ErrorLocatorRoots, ws->ErrorCount, rs->GF);
+	int period = rs->FieldOrder - 1;
+	int first_root_log = GF2Mod(1 - rs->FirstRoot, rs->GF);
+	for (int i = 0; i < ws->ErrorCount; i++) {
+		// Apply adjustment for first consecutive root. Both logs are reduced
+		// first and multiplied in long, since their product overflows int in
+		// the larger fields.
+		int adjust_log = (int)(((long)first_root_log * GF2Mod(-ws->ErrorLocatorRoots[i], rs->GF)) % period);
+		int numerator = GF2Mul(ws->ErrorMags[i], GF2Pow(adjust_log, rs->GF), rs->GF);
 		
 		// Take inverse of denominator term so division becomes multiplication.
-		rs->ErrorMags[i] = GF2Mul(GF2Inv(denominator, rs->GF), numerator, rs->GF);
+		ws->ErrorMags[i] = GF2Mul(GF2Inv(denominators[i], rs->GF), numerator, rs->GF);
 	}
 }
 
-int RSDecode(int *data_block, int block_size, RS2_def_struct *rs) {
-	rs->BlockSize = block_size;
-	rs->DataBlock = data_block;
-    
+int calc_corrections(const RS2_def_struct *rs, RS2_work_struct *ws) {
     // For clarity, the core operations of the decoder are split into
     // separate functions. Intermediate process results are stored in
-    // RS2_def_struct 'rs'
+    // RS2_work_struct 'ws'
 
-    // Calculate the Syndrome Polynomial
-    // Inputs:
-    //        rs.GF
-    //        rs.DataBlock[]
-    //        rs.BlockSize
-    //        rs.Genpoly[]
-    //        rs.FirstRoot
-    //        rs.Numroots
-    // Outputs:
-    //       rs.Syndromes[]
-	int s = calc_syndromes(rs);
-	
-	// Perform the Berlekamp algorithm to create the Error Locator Polynomial
+	// Perform the Berlekamp algorithm to create the Error Locator Polynomial,
+	// and the Error Magnitude Polynomial as the product of the Error Locator
+	// Polynomial and Syndrome Polynomial
 	// Inputs:
 	//        rs.GF
 	//        rs.Numroots
-	//        rs.Syndromes[]
+	//        ws.Syndromes[]
+	//        ws.Erasures[]
+	//        ws.ErasureCount
 	// Outputs:
-	//        rs.ErrorLocatorPolynomial[]
-	calc_berlekamp2(rs);
+	//        ws.ErrorLocatorPolynomial[]
+	//        ws.ErrorLocatorDegree
+	//        ws.ErrorMagPoly[]
+	RS2_STATS_START(stage_start_berlekamp);
+	calc_berlekamp2(rs, ws);
+	RS2_STATS_STAGE(ws, RS2_STAGE_BERLEKAMP, stage_start_berlekamp);
 	
 	// Find the roots of the Error Locator Polynomial via the Chien search
 	// Inputs:
 	//        rs.GF
 	//        rs.Numroots
 	//        rs.FieldOrder
-	//        rs.BlockSize
-	//        rs.ErrorLocatorPoly[]
+	//        ws.BlockSize
+	//        ws.ErrorLocatorPoly[]
+	//        ws.ErrorLocatorDegree
 	// Outputs:
-	//        rs.ErrorCount
-	//        rs.ErrorIndices[]
-	//        rs.ErrorLocatorRoots[]
-	calc_chien(rs);
+	//        ws.ErrorCount
+	//        ws.ErrorIndices[]
+	//        ws.ErrorLocatorRoots[]
+	RS2_STATS_START(stage_start_chien);
+	calc_chien(rs, ws);
+	RS2_STATS_STAGE(ws, RS2_STAGE_CHIEN, stage_start_chien);
+	if (ws->ErrorCount != ws->ErrorLocatorDegree) {
+		// A correctable pattern gives a locator of degree L with L distinct
+		// roots inside the block. Fewer means roots in the implicit zero
+		// prefix of a shortened code, repeated roots, or a locator that
+		// does not split: the block is uncorrectable, so skip Forney.
+		ws->ErrorCount = 0;
+		return -1;
+	}
 
-	// Calculate the Error Magnitude Polynomial as the product of the 
-	// Error Locator Polynomial and Syndrome Polynomial
+	// Calculate the Error Magnitudes using the Forney algorithm
 	// Inputs:
 	//        rs.GF
-	//        rs.ErrorCount
-	//        rs.Syndromes[]
-	//        rs.ErrorLocatorPoly[]
+	//        ws.ErrorCount
+	//        ws.ErrorLocatorDegree
+	//        ws.ErrorMagPoly[]
+	//        ws.ErrorLocatorPoly[]
+	//        ws.ErrorLocatorRoots[]
 	// Outputs:
-	//        rs.ErrorMagPoly[]
-	calc_error_value_poly(rs);
+	//        ws.ErrorMags[]
+	RS2_STATS_START(stage_start_forney);
+	calc_forney(rs, ws);
+	RS2_STATS_STAGE(ws, RS2_STAGE_FORNEY, stage_start_forney);
+	return 0;
+}
 
-	// Calculate the Error Magnitudes using the Forney algorithm
+int set_erasures(int block_size, const int *erasures, int erasure_count, const RS2_def_struct *rs, RS2_work_struct *ws) {
+	// Check and record the erasure list for the locator stage.
+	ws->BlockSize = block_size;
+	ws->ErrorCount = 0;
+	ws->Erasures = erasures;
+	ws->ErasureCount = 0;
+	if (check_block_size(block_size, rs)) {
+		return -1;
+	}
+	if ((erasure_count < 0) || (erasure_count > rs->NumRoots)) {
+		return -1;
+	}
+	for (int i = 0; i < erasure_count; i++) {
+		if ((erasures[i] < 0) || (erasures[i] >= block_size)) {
+			return -1;
+		}
+	}
+	// A repeated position would be counted twice against NumRoots and give
+	// the locator a double root. Mark each position, then clear only the
+	// marks set, so the bitmap costs erasure_count steps per decode.
+	uint8_t *marks = ws->ErasureMarks;
+	int duplicate = 0;
+	int marked = 0;
+	while ((marked < erasure_count) && !duplicate) {
+		int position = erasures[marked];
+		if (marks[position >> 3] & (1 << (position & 7))) {
+			duplicate = 1;
+		} else {
+			marks[position >> 3] |= (uint8_t)(1 << (position & 7));
+			marked++;
+		}
+	}
+	for (int i = 0; i < marked; i++) {
+		marks[erasures[i] >> 3] = 0;
+	}
+	if (duplicate) {
+		return -1;
+	}
+	ws->ErasureCount = erasure_count;
+	return 0;
+}
+
+int decode_stages(const RS2_def_struct *rs, RS2_work_struct *ws, int dirty) {
+	// The stages of RSDecodeErasures8 and RSDecodeErasures16 after the
+	// syndromes, which do not depend on the symbol width. Leaves the
+	// corrections for the caller to apply in ws->ErrorIndices[] and
+	// ws->ErrorMags[], ErrorCount of them, and returns the decode result.
+	if (dirty == 0) {
+		// Clean block, nothing to locate or correct.
+		save_syndromes(rs, ws);
+		ws->ErrorCount = 0;
+		RS2_STATS_FAST(ws);
+		return 0;
+	}
+
+	// Locate the errors and calculate their magnitudes
 	// Inputs:
-	//        rs.GF
-	//        rs.ErrorCount
-	//        rs.ErrorMagPoly[]
-	//        rs.ErrorLocatorPoly[]
-	//        rs.ErrorLocatorRoots[]
+	//        ws.Syndromes[]
+	//        ws.Erasures[]
+	//        ws.ErasureCount
 	// Outputs:
-	//        rs.ErrorMags[]
-	calc_forney(rs);
-
-	// Apply corrections to the received data block
-	for (int i = 0; i < rs->ErrorCount; i++) {
-		// Correct each detected error
-		data_block[rs->ErrorIndices[i]] = data_block[rs->ErrorIndices[i]] ^ rs->ErrorMags[i];
+	//        ws.ErrorCount
+	//        ws.ErrorIndices[]
+	//        ws.ErrorMags[]
+	if (calc_corrections(rs, ws) < 0) {
+		// Detected failure before any correction: ErrorCount is zero, so
+		// the block stays untouched, and the result counts the nonzero
+		// syndromes.
+		save_syndromes(rs, ws);
+		return -dirty;
 	}
 
 	// Save the pre-correction syndromes
 	// Inputs:
-	//         rs.Syndromes[]
+	//         ws.Syndromes[]
 	// Outputs:
-	//         rs.SavedSyndromes[]
-	save_syndromes(rs);
+	//         ws.SavedSyndromes[]
+	save_syndromes(rs, ws);
 
-	// Check for success by calculating syndromes (should be zero if no errors)
-	int nonzero = calc_syndromes(rs);
+	// Check for success by updating the syndromes with the corrections
+	// (should be zero if no errors remain). This only reads the corrections,
+	// not the block.
+	// Inputs:
+	//         ws.Syndromes[]
+	//         ws.ErrorCount
+	//         ws.ErrorIndices[]
+	//         ws.ErrorMags[]
+	// Outputs:
+	//         ws.Syndromes[]
+	RS2_STATS_START(verify_start);
+	int nonzero = update_syndromes(rs, ws);
+	RS2_STATS_STAGE(ws, RS2_STAGE_VERIFY, verify_start);
 	
 	if (nonzero) {
 		// Decoder indicates failure
 		return -nonzero;
 	}
 	// Decoder indicates success
-	return rs->ErrorCount; // return number of errors corrected    
+	return ws->ErrorCount; // return number of errors corrected    
+}
+
+int RSDecodeErasures8(uint8_t *data_block, int block_size, const int *erasures, int erasure_count, const RS2_def_struct *rs, RS2_work_struct *ws) {
+	if (set_erasures(block_size, erasures, erasure_count, rs, ws) || (rs->GF->Power > 8)) {
+		return -1;
+	}
+	RS2_STATS_START(decode_start);
+
+    // Calculate the Syndrome Polynomial
+    // Inputs:
+    //        rs.GF
+    //        data_block[]
+    //        ws.BlockSize
+    //        rs.FirstRoot
+    //        rs.Numroots
+    // Outputs:
+    //       ws.Syndromes[]
+	RS2_STATS_START(syndrome_start);
+	int dirty = calc_syndromes8(rs, ws, data_block);
+	RS2_STATS_STAGE(ws, RS2_STAGE_SYNDROMES, syndrome_start);
+
+	int result = decode_stages(rs, ws, dirty);
+
+	// Apply corrections to the received data block
+	for (int i = 0; i < ws->ErrorCount; i++) {
+		// Correct each detected error
+		data_block[ws->ErrorIndices[i]] = data_block[ws->ErrorIndices[i]] ^ ws->ErrorMags[i];
+	}
+	RS2_STATS_DECODE(ws, result, decode_start);
+	return result;
+}
+
+int RSDecodeErasures16(uint16_t *data_block, int block_size, const int *erasures, int erasure_count, const RS2_def_struct *rs, RS2_work_struct *ws) {
+	if (set_erasures(block_size, erasures, erasure_count, rs, ws)) {
+		return -1;
+	}
+	RS2_STATS_START(decode_start);
+
+	// Calculate the Syndrome Polynomial, as RSDecodeErasures8
+	RS2_STATS_START(syndrome_start);
+	int dirty = calc_syndromes16(rs, ws, data_block);
+	RS2_STATS_STAGE(ws, RS2_STAGE_SYNDROMES, syndrome_start);
+
+	int result = decode_stages(rs, ws, dirty);
+
+	// Apply corrections to the received data block
+	for (int i = 0; i < ws->ErrorCount; i++) {
+		// Correct each detected error
+		data_block[ws->ErrorIndices[i]] = data_block[ws->ErrorIndices[i]] ^ ws->ErrorMags[i];
+	}
+	RS2_STATS_DECODE(ws, result, decode_start);
+	return result;
+}
+
+int RSDecode8(uint8_t *data_block, int block_size, const RS2_def_struct *rs, RS2_work_struct *ws) {
+	return RSDecodeErasures8(data_block, block_size, NULL, 0, rs, ws);
+}
+
+int RSDecode16(uint16_t *data_block, int block_size, const RS2_def_struct *rs, RS2_work_struct *ws) {
+	return RSDecodeErasures16(data_block, block_size, NULL, 0, rs, ws);
+}
+
+int RSDecode(int *data_block, int block_size, const RS2_def_struct *rs, RS2_work_struct *ws) {
+	// Widen/narrow through the halfword decoder, in heap scratch sized to
+	// the block.
+	ws->ErrorCount = 0;
+	if (check_block_size(block_size, rs)) {
+		return -1;
+	}
+	uint16_t *block = malloc(sizeof(uint16_t) * block_size);
+	if (block == NULL) {
+		return -1;
+	}
+	for (int i = 0; i < block_size; i++) {
+		block[i] = data_block[i];
+	}
+	int result = RSDecode16(block, block_size, rs, ws);
+	for (int i = 0; i < ws->ErrorCount; i++) {
+		data_block[ws->ErrorIndices[i]] = block[ws->ErrorIndices[i]];
+	}
+	free(block);
+	return result;
+}
+
+int RSEncodeBatch8(uint8_t *blocks, int count, int message_size, const RS2_def_struct *rs) {
+	// Same division as RSEncode8, run on whole rows of the batch. The parity
+	// register is a ring of NumRoots rows; 'head' is the row holding the
+	// highest power. The batch is processed in tiles of RS2_BATCH_TILE
+	// codewords so the ring stays in L1.
+	int num_roots = rs->NumRoots;
+	if ((rs->GF->Power > 8) || check_block_size(message_size + num_roots, rs)) {
+		return -1;
+	}
+	uint8_t *ring = malloc((size_t)num_roots * RS2_BATCH_TILE);
+	if (ring == NULL) {
+		// Out of memory, encode one codeword at a time.
+		uint8_t block[RS2_MAX_BLOCK8];
+		for (int b = 0; b < count; b++) {
+			for (int j = 0; j < message_size; j++) {
+				block[j] = blocks[((size_t)j * count) + b];
+			}
+			RSEncode8(block, message_size, rs);
+			for (int j = message_size; j < message_size + num_roots; j++) {
+				blocks[((size_t)j * count) + b] = block[j];
+			}
+		}
+		return 0;
+	}
+	for (int tile = 0; tile < count; tile += RS2_BATCH_TILE) {
+		int width = (count - tile < RS2_BATCH_TILE) ? count - tile : RS2_BATCH_TILE;
+		memset(ring, 0, (size_t)num_roots * width);
+		int head = 0;
+		for (int i = 0; i < message_size; i++) {
+			// The head row becomes the feedback row, then is reused as the
+			// lowest power of the shifted register.
+			uint8_t *feedback = &ring[head * width];
+			xor_bytes(feedback, &blocks[((size_t)i * count) + tile], width);
+			for (int j = 0; j < num_roots - 1; j++) {
+				int slot = (head + 1 + j) % num_roots;
+				GF2MulAddRegion(&ring[slot * width], feedback, rs->Genpoly[num_roots - 1 - j], width, rs->GF);
+			}
+			GF2MulRegion(feedback, feedback, rs->Genpoly[0], width, rs->GF);
+			head = (head + 1) % num_roots;
+		}
+		for (int j = 0; j < num_roots; j++) {
+			memcpy(&blocks[((size_t)(message_size + j) * count) + tile], &ring[((head + j) % num_roots) * width], width);
+		}
+	}
+	free(ring);
+	return 0;
+}
+
+void decode_batch_column8(uint8_t *blocks, int count, int block_size, int b, int *results, const RS2_def_struct *rs, RS2_work_struct *ws) {
+	// Run the single codeword decoder on column b of an interleaved batch.
+	uint8_t block[RS2_MAX_BLOCK8];
+	for (int j = 0; j < block_size; j++) {
+		block[j] = blocks[((size_t)j * count) + b];
+	}
+	results[b] = RSDecode8(block, block_size, rs, ws);
+	for (int i = 0; i < ws->ErrorCount; i++) {
+		blocks[((size_t)ws->ErrorIndices[i] * count) + b] = block[ws->ErrorIndices[i]];
+	}
+}
+
+int RSDecodeBatch8(uint8_t *blocks, int count, int block_size, int *results, const RS2_def_struct *rs, RS2_work_struct *ws) {
+	int num_roots = rs->NumRoots;
+	int failures = 0;
+	if ((rs->GF->Power > 8) || check_block_size(block_size, rs)) {
+		for (int b = 0; b < count; b++) {
+			results[b] = -1;
+		}
+		ws->ErrorCount = 0;
+		return count;
+	}
+	// One syndrome row per root plus a row flagging codewords with errors.
+	uint8_t *syndromes = malloc((size_t)(num_roots + 1) * RS2_BATCH_TILE);
+	if (syndromes == NULL) {
+		// Out of memory, decode one codeword at a time.
+		for (int b = 0; b < count; b++) {
+			decode_batch_column8(blocks, count, block_size, b, results, rs, ws);
+			if (results[b] < 0) {
+				failures++;
+			}
+		}
+		return failures;
+	}
+	int root_logs[RS2_MAX_ROOTS8];
+	int exponents[RS2_MAX_ROOTS8];
+	for (int i = 0; i < num_roots; i++) {
+		root_logs[i] = GF2Mod(rs->FirstRoot + i, rs->GF);
+	}
+	for (int tile = 0; tile < count; tile += RS2_BATCH_TILE) {
+		int width = (count - tile < RS2_BATCH_TILE) ? count - tile : RS2_BATCH_TILE;
+		uint8_t *dirty = &syndromes[num_roots * width];
+		RS2_STATS_START(batch_start);
+		memset(syndromes, 0, (size_t)(num_roots + 1) * width);
+		// Syndrome i of every codeword: sum over rows j of row_j * root_i^(n-1-j).
+		// Each term is one multiply-accumulate of a row by a constant, and each
+		// row is read once for all syndromes.
+		for (int i = 0; i < num_roots; i++) {
+			exponents[i] = 0; // log of root_i^(n-1-j), starting from the last row
+		}
+		for (int j = block_size - 1; j >= 0; j--) {
+			const uint8_t *row = &blocks[((size_t)j * count) + tile];
+			for (int i = 0; i < num_roots; i++) {
+				GF2MulAddRegion(&syndromes[i * width], row, GF2Pow(exponents[i], rs->GF), width, rs->GF);
+				exponents[i] = GF2Mod(exponents[i] + root_logs[i], rs->GF);
+			}
+		}
+		for (int i = 0; i < num_roots; i++) {
+			for (int b = 0; b < width; b++) {
+				dirty[b] |= syndromes[(i * width) + b];
+			}
+		}
+		RS2_STATS_STAGE(ws, RS2_STAGE_BATCH_SYNDROMES, batch_start);
+		// Only codewords with a nonzero syndrome fall through to the full decoder.
+		for (int b = 0; b < width; b++) {
+			if (dirty[b] == 0) {
+				results[tile + b] = 0;
+				RS2_STATS_CLEAN(ws, 1);
+				continue;
+			}
+			decode_batch_column8(blocks, count, block_size, tile + b, results, rs, ws);
+			if (results[tile + b] < 0) {
+				failures++;
+			}
+		}
+	}
+	free(syndromes);
+	return failures;
 }
\ No newline at end of file
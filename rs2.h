@@ -14,23 +14,134 @@
 // Initializes Reed Solomon parameters in memory for library functions.
 // Arg1: starting root for generator polynomial
 // Arg2: number of roots in generator polynomial
-void InitRS2(int, int, RS2_def_struct*);
+// Allocates the generator polynomial and encoder tables; call FreeRS2 before
+// initializing again. The tables are cached process-wide, so initializing a
+// code with the same field, first root and root count again is nearly free.
+// Thread safe.
+// Returns 0 on success, -1 if the root count is not below FieldOrder - 1 or
+// memory could not be allocated.
+int InitRS2(int, int, RS2_def_struct*);
+
+// FreeRS2
+// Releases memory allocated by InitRS2.
+void FreeRS2(RS2_def_struct*);
+
+// InitRS2Work
+// Allocates decoder scratch space sized to the code's NumRoots, and a bitmap
+// of FieldOrder bits for checking erasure lists. Each thread decoding with a
+// shared RS2_def_struct needs its own workspace.
+// Returns 0 on success, -1 if memory could not be allocated.
+int InitRS2Work(const RS2_def_struct*, RS2_work_struct*);
+
+// FreeRS2Work
+// Releases memory allocated by InitRS2Work and RS2SetPool. The pool itself
+// stays up.
+void FreeRS2Work(RS2_work_struct*);
+
+// RS2SetPool
+// Lets decodes with this workspace split the syndromes and Chien search of
+// blocks of RS2_PARALLEL_MIN_BLOCK symbols or more across a thread pool
+// started by InitRS2Pool. Each workspace needs a pool of its own.
+// Arg2: pool, or NULL to decode on the calling thread only
+// Returns 0 on success, -1 if memory could not be allocated.
+int RS2SetPool(RS2_work_struct*, struct RS2_pool_struct*);
+
+// Block sizes
+// Every encoder and decoder works on blocks of message plus NumRoots parity
+// symbols, from NumRoots + 1 up to FieldOrder - 1 symbols in all; the 8-bit
+// entry points also need a field of 8 bits or less. Other sizes are rejected
+// with -1 before the buffer is touched.
 
 // RSEncode
 // Computes Reed Solomon parity symbols for input array and appends them to the
 // end of the original array.
 // Arg1: pointer to first word of input array
-// Arg2: word count of input array
-void RSEncode(int *, int, RS2_def_struct*);
+// Arg2: message word count; the array needs room for NumRoots more
+// Returns 0, or -1 if the block size is out of range or scratch memory could
+// not be allocated.
+int RSEncode(int *, int, const RS2_def_struct*);
 
 // RSDecode
 // Computes error locations and values based on Reed Solomon parity symbols
 // appended to end of input array. Corrects input array if possible.
 // Arg1: pointer to first word of input array
 // Arg2: word count of input array
-// Returns number of errors corrected. Returns negative if correction failed.
+// Returns number of errors corrected. Returns negative if correction failed,
+// or -1 if the block size is out of range or scratch memory could not be
+// allocated.
 // Clobbers input array.
-int RSDecode(int *, int, RS2_def_struct*);
+int RSDecode(int *, int, const RS2_def_struct*, RS2_work_struct*);
+
+// RSEncode8
+// Same as RSEncode, for fields of 8 bits or less with one symbol per byte.
+// Arg1: pointer to first symbol of input array
+// Arg2: message symbol count; the buffer needs room for NumRoots more
+// Returns 0, or -1 if the block size or field is out of range.
+int RSEncode8(uint8_t *, int, const RS2_def_struct*);
+
+// RSDecode8
+// Same as RSDecode, for fields of 8 bits or less with one symbol per byte.
+// Corrects the block in place.
+// Arg1: pointer to first symbol of input array
+// Arg2: symbol count of input array
+// Returns number of errors corrected. Returns negative if correction failed.
+int RSDecode8(uint8_t *, int, const RS2_def_struct*, RS2_work_struct*);
+
+// RSEncode16
+// Same as RSEncode, with one symbol per 16-bit halfword. Any field size.
+// Arg1: pointer to first symbol of input array
+// Arg2: message symbol count; the buffer needs room for NumRoots more
+// Returns 0, or -1 if the block size is out of range.
+int RSEncode16(uint16_t *, int, const RS2_def_struct*);
+
+// RSDecode16
+// Same as RSDecode, with one symbol per 16-bit halfword. Any field size.
+// Corrects the block in place.
+// Arg1: pointer to first symbol of input array
+// Arg2: symbol count of input array
+// Returns number of errors corrected. Returns negative if correction failed.
+int RSDecode16(uint16_t *, int, const RS2_def_struct*, RS2_work_struct*);
+
+// RSDecodeErasures8
+// Same as RSDecode8, with a list of erasures: positions known to be suspect.
+// Corrects e errors and f erasures when 2e + f <= NumRoots. Erasures that
+// turn out correct get a zero magnitude. Corrects the block in place.
+// Arg1: pointer to first symbol of input array
+// Arg2: symbol count of input array
+// Arg3: array of distinct erased positions, 0 to (Arg2 - 1)
+// Arg4: erasure count, at most NumRoots
+// Returns number of symbols corrected, erasures included. Returns negative
+// if correction failed, or -1 if the erasure list or block size is invalid.
+int RSDecodeErasures8(uint8_t *, int, const int *, int, const RS2_def_struct*, RS2_work_struct*);
+
+// RSDecodeErasures16
+// Same as RSDecodeErasures8, with one symbol per 16-bit halfword. Any field
+// size.
+int RSDecodeErasures16(uint16_t *, int, const int *, int, const RS2_def_struct*, RS2_work_struct*);
+
+// RSEncodeBatch8
+// Encodes a batch of codewords with the same parameters, stored
+// symbol-interleaved: symbol j of codeword b is at blocks[(j * count) + b].
+// Each codeword symbol position is processed for the whole batch at once with
+// the region kernels. Fields of 8 bits or less.
+// Arg1: pointer to interleaved blocks, with room for the parity rows
+// Arg2: number of codewords in the batch
+// Arg3: message symbol count of each codeword
+// Returns 0, or -1 if the block size or field is out of range.
+int RSEncodeBatch8(uint8_t *, int, int, const RS2_def_struct*);
+
+// RSDecodeBatch8
+// Decodes a batch of symbol-interleaved codewords (layout as RSEncodeBatch8).
+// Syndromes are computed across the batch; only codewords with a nonzero
+// syndrome go through the error locator and magnitude stages. Corrects the
+// blocks in place. Decoder state in 'ws' is left from the last such codeword.
+// Arg1: pointer to interleaved blocks
+// Arg2: number of codewords in the batch
+// Arg3: symbol count of each codeword
+// Arg4: array of 'count' results, each as returned by RSDecode8
+// Returns number of codewords the decoder could not correct; all of them if
+// the block size or field is out of range.
+int RSDecodeBatch8(uint8_t *, int, int, int *, const RS2_def_struct*, RS2_work_struct*);
 
 
 
@@ -12,26 +12,200 @@
 
 #include "gf2_def_struct.h"
 
-// Change to suit your application. Bigger = more memory allocated.
-#define MAX_GENPOLY_ROOTS 256
+// Longest block, and most roots, a code over a field of 8 bits or less can
+// have. Sizes the stack scratch of the byte-oriented paths; everything else
+// is sized to the code.
+#define RS2_MAX_BLOCK8 255
+#define RS2_MAX_ROOTS8 255
 
+// Largest per-code table InitRS2 will build, in bytes. Codes over large
+// fields with many roots skip the tables and fall back to GF2Mul.
+#define RS2_TABLE_LIMIT (16 << 20)
+
+// Largest MulRootTable16 InitRS2 will build, in bytes. Past this the syndrome
+// Horner loop does better on the smaller log and antilog tables.
+#define RS2_HORNER_TABLE_LIMIT (1 << 20)
+
+// Codes kept by InitRS2's process-wide cache. Further codes are built and
+// freed as before.
+#define RS2_CACHE_SIZE 16
+
+// Codewords per tile in the batch encoder and decoder. NumRoots rows of this
+// width should stay cache resident.
+#define RS2_BATCH_TILE 2048
+
+// Candidate positions evaluated together by the Chien search on fields of
+// 8 bits or less. Blocks shorter than this use the one-at-a-time search.
+#define RS2_CHIEN_LANES 64
+
+// Fewest roots for which syndromes use the region kernels across syndromes
+// instead of the per-root Horner tables.
+#define RS2_SYNDROME_ROWS_MIN 16
+
+// Shortest block whose syndromes and Chien search are split across a
+// workspace's thread pool. Shorter blocks do not cover the wakeup cost.
+#define RS2_PARALLEL_MIN_BLOCK 2048
+
+// Crossovers for the additive FFT on fields over 8 bits: syndromes and the
+// Chien search evaluate every field element by transform once BlockSize
+// times the terms evaluated exceeds this many times FieldOrder * Power.
+// Direct syndromes cost less per term, on the Horner tables.
+#define RS2_FFT_SYNDROME_COST 6
+#define RS2_FFT_CHIEN_COST 3
+
+// Thread pool from rs2_pool.h.
+struct RS2_pool_struct;
+
+// A codec specialized at compile time for one code, from rs2_fixed.c. The
+// functions take whole blocks of exactly BlockSize symbols, and the syndrome
+// functions, NULL where the generic ones are faster, return the count of
+// nonzero syndromes.
+typedef struct {
+	int GenPoly;
+	int FirstRoot;
+	int BlockSize;
+	int MessageSize;
+	const uint8_t *Genpoly;
+	void (*Encode8)(uint8_t*);
+	void (*Encode16)(uint16_t*);
+	int (*Syndromes8)(const uint8_t*, GF2_elem_t*);
+	int (*Syndromes16)(const uint16_t*, GF2_elem_t*);
+} RS2_fixed_struct;
+
+// Code parameters. Read-only once InitRS2 returns, so one instance may be
+// shared by any number of threads.
 typedef struct {
     GF2_def_struct *GF;
-    int Genpoly[MAX_GENPOLY_ROOTS + 1];
-	int SavedSyndromes[MAX_GENPOLY_ROOTS];
-	int Syndromes[MAX_GENPOLY_ROOTS];
-    int ErrorIndices[MAX_GENPOLY_ROOTS];
-	int ErrorMagPoly[MAX_GENPOLY_ROOTS];
-    int ErrorMags[MAX_GENPOLY_ROOTS];
-	int ErrorLocatorPoly[MAX_GENPOLY_ROOTS];
-	int ErrorLocatorRoots[MAX_GENPOLY_ROOTS];
-	int *DataBlock;
+    // Generator polynomial, NumRoots + 1 coefficients lowest power first.
+    GF2_elem_t *Genpoly;
+	// Encoder product rows, allocated by InitRS2. Row x holds x times each
+	// generator coefficient, highest power first (Genpoly[NumRoots - 1] down to
+	// Genpoly[0]), NumRoots per row.
+	// EncodeTable8 is only built for fields of 8 bits or less.
+	uint8_t *EncodeTable8;
+	uint16_t *EncodeTable16;
+	// Syndrome tables, allocated by InitRS2. MulRootTable16 holds one row of
+	// FieldOrder products per root. SyndromeTable8 holds FieldOrder - 1 rows of
+	// NumRoots root powers, and is only built for fields of 8 bits or less.
+	uint8_t *SyndromeTable8;
+	uint16_t *MulRootTable16;
+	// Additive FFT plan, allocated by InitRS2 for fields over 8 bits when a
+	// full length block of this code would use it; NULL otherwise.
+	GF2_fft_struct *FFT;
+	// Specialized codec matching this code, or NULL. Set by InitRS2.
+	const RS2_fixed_struct *Fixed;
+	int Cached; // tables belong to the code cache, FreeRS2 leaves them
     int FirstRoot;
     int NumRoots;
     int FieldOrder;
+} RS2_def_struct;
+
+#ifdef RS2_STATS
+// Decoder stages timed by the instrumentation in rs2_stats.c.
+#define RS2_STAGE_SYNDROMES 0
+#define RS2_STAGE_BERLEKAMP 1
+#define RS2_STAGE_CHIEN 2
+#define RS2_STAGE_FORNEY 3
+#define RS2_STAGE_VERIFY 4
+#define RS2_STAGE_BATCH_SYNDROMES 5
+#define RS2_STAGE_COUNT 6
+// Latency histogram rows by symbols corrected; the last of these rows also
+// holds larger counts, and one more row holds failed decodes.
+#define RS2_STATS_ROWS 64
+// Power-of-two latency buckets per row.
+#define RS2_STATS_BUCKETS 40
+
+// Decoder counters, one set per workspace. Times are in RS2StatsUnit() ticks.
+typedef struct {
+	uint64_t StageTime[RS2_STAGE_COUNT];
+	uint64_t StageCalls[RS2_STAGE_COUNT];
+	uint64_t Decodes;
+	uint64_t FastPath; // clean blocks, done after the syndromes
+	uint64_t Failed;
+	uint64_t LatencyTime[RS2_STATS_ROWS + 1];
+	uint64_t Latency[RS2_STATS_ROWS + 1][RS2_STATS_BUCKETS];
+} RS2_stats_struct;
+#endif
+
+// Per-decode scratch and results. One per thread, allocated by InitRS2Work
+// and reused across decodes. Arrays hold Size = NumRoots + 1 symbols.
+typedef struct {
+	GF2_elem_t *SavedSyndromes;
+	GF2_elem_t *Syndromes;
+    GF2_elem_t *ErrorIndices;
+	GF2_elem_t *ErrorMagPoly;
+    GF2_elem_t *ErrorMags;
+	GF2_elem_t *ErrorLocatorPoly;
+	GF2_elem_t *ErrorLocatorRoots;
+	GF2_elem_t *Scratch; // 3 * Size symbols for Berlekamp-Massey
+	GF2_elem_t *Memory;
+	int *Registers; // 2 * Size ints for the syndrome and Chien registers
+	// FFT input and scratch, 2 * FieldOrder symbols, when the code has an
+	// FFT plan; NULL otherwise.
+	GF2_elem_t *Transform;
+	// Chien start offsets for shortened codes: entry i is the log of a^i at
+	// the first real position, (FieldOrder - BlockSize) * i mod
+	// (FieldOrder - 1). Size ints, rebuilt when the block size changes.
+	int *ChienStart;
+	int ChienBlockSize; // block size ChienStart was built for, 0 if none
+	// Optional pool for long blocks, set by RS2SetPool, with per-chunk
+	// scratch: PoolChunks sets of Size syndromes and 3 * Size + 1 ints.
+	struct RS2_pool_struct *Pool;
+	int PoolChunks;
+	GF2_elem_t *PoolSyndromes;
+	int *PoolRegisters;
+	int Size;
 	int BlockSize;
     int ErrorCount;
-} RS2_def_struct;
+	int ErrorLocatorDegree; // L from Berlekamp-Massey
+	const int *Erasures; // known bad positions for the current decode
+	int ErasureCount;
+	// Bitmap of FieldOrder bits marking the erasures while the list is
+	// checked for duplicates, all clear between decodes.
+	uint8_t *ErasureMarks;
+#ifdef RS2_STATS
+	RS2_stats_struct Stats;
+#endif
+} RS2_work_struct;
+
+// Shard erasure code, from rs2_shard.c. Bytes per tile of the shard loops;
+// the destination tiles of one pass should stay in L1.
+#define RS2_SHARD_TILE 4096
+// Decode matrices kept per shard workspace, by erasure pattern.
+#define RS2_SHARD_CACHE_SIZE 16
+
+// Shard code parameters, set by InitRS2Shards. Read-only afterwards, so one
+// instance may be shared by any number of threads.
+typedef struct {
+	const RS2_def_struct *RS;
+	int DataShards; // k
+	int ParityShards; // m, the code's NumRoots
+	// Systematic encoding matrix: row p holds the DataShards coefficients of
+	// parity shard p, the parity RSEncode8 gives each unit message.
+	uint8_t *Parity;
+} RS2_shard_struct;
+
+// One cached decode matrix. The key is the bitmap of the DataShards shards
+// the matrix decodes from; Rows holds a row of DataShards coefficients for
+// each missing data shard, in shard order.
+typedef struct {
+	uint64_t Key[4];
+	uint8_t *Rows;
+	int Used;
+} RS2_shard_cache_struct;
+
+// Per-thread rebuild scratch and decode matrix cache, allocated by
+// InitRS2ShardWork and reused across rebuilds.
+typedef struct {
+	RS2_shard_cache_struct Cache[RS2_SHARD_CACHE_SIZE];
+	int NextEntry; // cache entry replaced next, round robin
+	uint8_t *Matrix; // DataShards rows of 2 * DataShards for Gauss-Jordan
+	int *Survivors; // DataShards shard indices decoded from
+	int *Missing; // missing shard indices, DataShards + ParityShards at most
+	const uint8_t **Sources; // Survivors' buffers
+	long CacheHits;
+	long CacheMisses;
+} RS2_shard_work_struct;
 
 #endif	/* RS2_DEF_STRUCT_H */
 
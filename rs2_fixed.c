@@ -0,0 +1,121 @@
+#include <string.h>
+#include "rs2_fixed.h"
+
+// Build with RS2_NO_FIXED to leave out the specialized codecs, e.g. for the
+// table generator itself, which must build before rs2_fixed_tables.h exists.
+#ifndef RS2_NO_FIXED
+#include "rs2_fixed_tables.h"
+
+// Specialized encoder and syndrome functions for one code. Block size,
+// message size and field order are constants, so every loop has a fixed trip
+// count the compiler can unroll and vectorize. Tables come from
+// rs2_fixed_tables.h, generated by tools/rs2_fixed_gen.c.
+// The encoder is the long division of RSEncode8 over a scratch copy of the
+// block; the syndromes are the one-pass Horner form of calc_syndromes8.
+#define RS2_FIXED_CODEC(name, ORDER, N, K) \
+	void name##_encode8(uint8_t *message) { \
+		uint8_t work[N]; \
+		memcpy(work, message, K); \
+		memset(&work[K], 0, N - K); \
+		for (int i = 0; i < K; i++) { \
+			const uint8_t *row = &name##_encode[(work[i] & (ORDER - 1)) * (N - K)]; \
+			for (int j = 0; j < N - K; j++) { \
+				work[i + 1 + j] ^= row[j]; \
+			} \
+		} \
+		memcpy(&message[K], &work[K], N - K); \
+	} \
+	void name##_encode16(uint16_t *message) { \
+		uint8_t work[N]; \
+		for (int i = 0; i < K; i++) { \
+			work[i] = message[i] & (ORDER - 1); \
+		} \
+		memset(&work[K], 0, N - K); \
+		for (int i = 0; i < K; i++) { \
+			const uint8_t *row = &name##_encode[work[i] * (N - K)]; \
+			for (int j = 0; j < N - K; j++) { \
+				work[i + 1 + j] ^= row[j]; \
+			} \
+		} \
+		for (int i = K; i < N; i++) { \
+			message[i] = work[i]; \
+		} \
+	} \
+	int name##_syndromes8(const uint8_t *data, GF2_elem_t *syndromes) { \
+		uint8_t acc[N - K]; \
+		memset(acc, 0, N - K); \
+		for (int j = 0; j < N - 1; j++) { \
+			uint8_t symbol = data[j] & (ORDER - 1); \
+			for (int i = 0; i < N - K; i++) { \
+				acc[i] = name##_mulroot[(i * ORDER) + (acc[i] ^ symbol)]; \
+			} \
+		} \
+		int nonzero = 0; \
+		for (int i = 0; i < N - K; i++) { \
+			syndromes[i] = acc[i] ^ (data[N - 1] & (ORDER - 1)); \
+			nonzero += (syndromes[i] != 0); \
+		} \
+		return nonzero; \
+	} \
+	int name##_syndromes16(const uint16_t *data, GF2_elem_t *syndromes) { \
+		uint8_t acc[N - K]; \
+		memset(acc, 0, N - K); \
+		for (int j = 0; j < N - 1; j++) { \
+			uint8_t symbol = data[j] & (ORDER - 1); \
+			for (int i = 0; i < N - K; i++) { \
+				acc[i] = name##_mulroot[(i * ORDER) + (acc[i] ^ symbol)]; \
+			} \
+		} \
+		int nonzero = 0; \
+		for (int i = 0; i < N - K; i++) { \
+			syndromes[i] = acc[i] ^ (data[N - 1] & (ORDER - 1)); \
+			nonzero += (syndromes[i] != 0); \
+		} \
+		return nonzero; \
+	}
+
+// Registry entry for a codec instantiated above. From RS2_SYNDROME_ROWS_MIN
+// roots up, the generic syndromes, vectorized across roots by the region
+// kernels, beat the unrolled Horner lookups, so those entries leave the
+// syndrome functions out.
+#define RS2_FIXED_ENTRY(name, POLY, FCR, N, K) \
+	{POLY, FCR, N, K, name##_genpoly, name##_encode8, name##_encode16, \
+	((N - K) < RS2_SYNDROME_ROWS_MIN) ? name##_syndromes8 : NULL, \
+	((N - K) < RS2_SYNDROME_ROWS_MIN) ? name##_syndromes16 : NULL}
+
+RS2_FIXED_CODEC(rs2_fixed_285_0_255_223, 256, 255, 223)
+RS2_FIXED_CODEC(rs2_fixed_285_0_15_13, 256, 15, 13)
+
+const RS2_fixed_struct fixed_codecs[] = {
+	RS2_FIXED_ENTRY(rs2_fixed_285_0_255_223, 285, 0, 255, 223),
+	RS2_FIXED_ENTRY(rs2_fixed_285_0_15_13, 285, 0, 15, 13),
+};
+
+#endif
+
+const RS2_fixed_struct *RS2FindFixed(const RS2_def_struct *rs) {
+#ifdef RS2_NO_FIXED
+	(void)rs;
+	return NULL;
+#else
+	for (int c = 0; c < (int)(sizeof(fixed_codecs) / sizeof(fixed_codecs[0])); c++) {
+		const RS2_fixed_struct *fixed = &fixed_codecs[c];
+		if ((fixed->GenPoly != rs->GF->GenPoly) || (fixed->FirstRoot != rs->FirstRoot)) {
+			continue;
+		}
+		if (fixed->BlockSize - fixed->MessageSize != rs->NumRoots) {
+			continue;
+		}
+		int match = 1;
+		for (int i = 0; i <= rs->NumRoots; i++) {
+			if (fixed->Genpoly[i] != rs->Genpoly[i]) {
+				match = 0;
+			}
+		}
+		if (match) {
+			return fixed;
+		}
+	}
+	return NULL;
+#endif
+}
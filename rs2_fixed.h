@@ -0,0 +1,22 @@
+/*
+ * File:   rs2_fixed.h
+ *
+ * Created on October 17, 2026
+ */
+
+#ifndef RS2_FIXED_H
+#define	RS2_FIXED_H
+
+#include "rs2_def_struct.h"
+
+// RS2FindFixed
+// Looks up a codec specialized at compile time for the field, first root and
+// root count of a code, checking its generator polynomial against the one
+// InitRS2 built. InitRS2 stores the result in rs->Fixed; encoders and
+// decoders use it when the block and message sizes also match, and the
+// generic path otherwise.
+// Arg1: initialized code parameters
+// Returns NULL if no specialized codec matches.
+const RS2_fixed_struct *RS2FindFixed(const RS2_def_struct*);
+
+#endif	/* RS2_FIXED_H */
@@ -0,0 +1,1126 @@
+/*
+ * File:   rs2_fixed_tables.h
+ *
+ * Generated by tools/rs2_fixed_gen.c. Do not edit.
+ */
+
+#ifndef RS2_FIXED_TABLES_H
+#define	RS2_FIXED_TABLES_H
+
+#include <stdint.h>
+
+// GF 285, first root 0, (255, 223)
+
+static const uint8_t rs2_fixed_285_0_255_223_genpoly[33] = {
+	88, 172, 55, 142, 20, 253, 138, 24, 185, 179, 47, 148, 228, 253, 55, 59,
+	12, 225, 197, 176, 157, 33, 33, 162, 194, 16, 126, 54, 174, 52, 64, 116,
+	1, 
+};
+
+static const uint8_t rs2_fixed_285_0_255_223_encode[8192] = {
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	116, 64, 52, 174, 54, 126, 16, 194, 162, 33, 33, 157, 176, 197, 225, 12,
+	59, 55, 253, 228, 148, 47, 179, 185, 24, 138, 253, 20, 142, 55, 172, 88,
+	232, 128, 104, 65, 108, 252, 32, 153, 89, 66, 66, 39, 125, 151, 223, 24,
+	118, 110, 231, 213, 53, 94, 123, 111, 48, 9, 231, 40, 1, 110, 69, 176,
+	156, 192, 92, 239, 90, 130, 48, 91, 251, 99, 99, 186, 205, 82, 62, 20,
+	77, 89, 26, 49, 161, 113, 200, 214, 40, 131, 26, 60, 143, 89, 233, 232,
+	205, 29, 208, 130, 216, 229, 64, 47, 178, 132, 132, 78, 250, 51, 163, 48,
+	236, 220, 211, 183, 106, 188, 246, 222, 96, 18, 211, 80, 2, 220, 138, 125,
+	185, 93, 228, 44, 238, 155, 80, 237, 16, 165, 165, 211, 74, 246, 66, 60,
+	215, 235, 46, 83, 254, 147, 69, 103, 120, 152, 46, 68, 140, 235, 38, 37,
+	37, 157, 184, 195, 180, 25, 96, 182, 235, 198, 198, 105, 135, 164, 124, 40,
+	154, 178, 52, 98, 95, 226, 141, 177, 80, 27, 52, 120, 3, 178, 207, 205,
+	81, 221, 140, 109, 130, 103, 112, 116, 73, 231, 231, 244, 55, 97, 157, 36,
+	161, 133, 201, 134, 203, 205, 62, 8, 72, 145, 201, 108, 141, 133, 99, 149,
+	135, 58, 189, 25, 173, 215, 128, 94, 121, 21, 21, 156, 233, 102, 91, 96,
+	197, 165, 187, 115, 212, 101, 241, 161, 192, 36, 187, 160, 4, 165, 9, 250,
+	243, 122, 137, 183, 155, 169, 144, 156, 219, 52, 52, 1, 89, 163, 186, 108,
+	254, 146, 70, 151, 64, 74, 66, 24, 216, 174, 70, 180, 138, 146, 165, 162,
+	111, 186, 213, 88, 193, 43, 160, 199, 32, 87, 87, 187, 148, 241, 132, 120,
+	179, 203, 92, 166, 225, 59, 138, 206, 240, 45, 92, 136, 5, 203, 76, 74,
+	27, 250, 225, 246, 247, 85, 176, 5, 130, 118, 118, 38, 36, 52, 101, 116,
+	136, 252, 161, 66, 117, 20, 57, 119, 232, 167, 161, 156, 139, 252, 224, 18,
+	74, 39, 109, 155, 117, 50, 192, 113, 203, 145, 145, 210, 19, 85, 248, 80,
+	41, 121, 104, 196, 190, 217, 7, 127, 160, 54, 104, 240, 6, 121, 131, 135,
+	62, 103, 89, 53, 67, 76, 208, 179, 105, 176, 176, 79, 163, 144, 25, 92,
+	18, 78, 149, 32, 42, 246, 180, 198, 184, 188, 149, 228, 136, 78, 47, 223,
+	162, 167, 5, 218, 25, 206, 224, 232, 146, 211, 211, 245, 110, 194, 39, 72,
+	95, 23, 143, 17, 139, 135, 124, 16, 144, 63, 143, 216, 7, 23, 198, 55,
+	214, 231, 49, 116, 47, 176, 240, 42, 48, 242, 242, 104, 222, 7, 198, 68,
+	100, 32, 114, 245, 31, 168, 207, 169, 136, 181, 114, 204, 137, 32, 106, 111,
+	19, 116, 103, 50, 71, 179, 29, 188, 242, 42, 42, 37, 207, 204, 182, 192,
+	151, 87, 107, 230, 181, 202, 255, 95, 157, 72, 107, 93, 8, 87, 18, 233,
+	103, 52, 83, 156, 113, 205, 13, 126, 80, 11, 11, 184, 127, 9, 87, 204,
+	172, 96, 150, 2, 33, 229, 76, 230, 133, 194, 150, 73, 134, 96, 190, 177,
+	251, 244, 15, 115, 43, 79, 61, 37, 171, 104, 104, 2, 178, 91, 105, 216,
+	225, 57, 140, 51, 128, 148, 132, 48, 173, 65, 140, 117, 9, 57, 87, 89,
+	143, 180, 59, 221, 29, 49, 45, 231, 9, 73, 73, 159, 2, 158, 136, 212,
+	218, 14, 113, 215, 20, 187, 55, 137, 181, 203, 113, 97, 135, 14, 251, 1,
+	222, 105, 183, 176, 159, 86, 93, 147, 64, 174, 174, 107, 53, 255, 21, 240,
+	123, 139, 184, 81, 223, 118, 9, 129, 253, 90, 184, 13, 10, 139, 152, 148,
+	170, 41, 131, 30, 169, 40, 77, 81, 226, 143, 143, 246, 133, 58, 244, 252,
+	64, 188, 69, 181, 75, 89, 186, 56, 229, 208, 69, 25, 132, 188, 52, 204,
+	54, 233, 223, 241, 243, 170, 125, 10, 25, 236, 236, 76, 72, 104, 202, 232,
+	13, 229, 95, 132, 234, 40, 114, 238, 205, 83, 95, 37, 11, 229, 221, 36,
+	66, 169, 235, 95, 197, 212, 109, 200, 187, 205, 205, 209, 248, 173, 43, 228,
+	54, 210, 162, 96, 126, 7, 193, 87, 213, 217, 162, 49, 133, 210, 113, 124,
+	148, 78, 218, 43, 234, 100, 157, 226, 139, 63, 63, 185, 38, 170, 237, 160,
+	82, 242, 208, 149, 97, 175, 14, 254, 93, 108, 208, 253, 12, 242, 27, 19,
+	224, 14, 238, 133, 220, 26, 141, 32, 41, 30, 30, 36, 150, 111, 12, 172,
+	105, 197, 45, 113, 245, 128, 189, 71, 69, 230, 45, 233, 130, 197, 183, 75,
+	124, 206, 178, 106, 134, 152, 189, 123, 210, 125, 125, 158, 91, 61, 50, 184,
+	36, 156, 55, 64, 84, 241, 117, 145, 109, 101, 55, 213, 13, 156, 94, 163,
+	8, 142, 134, 196, 176, 230, 173, 185, 112, 92, 92, 3, 235, 248, 211, 180,
+	31, 171, 202, 164, 192, 222, 198, 40, 117, 239, 202, 193, 131, 171, 242, 251,
+	89, 83, 10, 169, 50, 129, 221, 205, 57, 187, 187, 247, 220, 153, 78, 144,
+	190, 46, 3, 34, 11, 19, 248, 32, 61, 126, 3, 173, 14, 46, 145, 110,
+	45, 19, 62, 7, 4, 255, 205, 15, 155, 154, 154, 106, 108, 92, 175, 156,
+	133, 25, 254, 198, 159, 60, 75, 153, 37, 244, 254, 185, 128, 25, 61, 54,
+	177, 211, 98, 232, 94, 125, 253, 84, 96, 249, 249, 208, 161, 14, 145, 136,
+	200, 64, 228, 247, 62, 77, 131, 79, 13, 119, 228, 133, 15, 64, 212, 222,
+	197, 147, 86, 70, 104, 3, 237, 150, 194, 216, 216, 77, 17, 203, 112, 132,
+	243, 119, 25, 19, 170, 98, 48, 246, 21, 253, 25, 145, 129, 119, 120, 134,
+	38, 232, 206, 100, 142, 123, 58, 101, 249, 84, 84, 74, 131, 133, 113, 157,
+	51, 174, 214, 209, 119, 137, 227, 190, 39, 144, 214, 186, 16, 174, 36, 207,
+	82, 168, 250, 202, 184, 5, 42, 167, 91, 117, 117, 215, 51, 64, 144, 145,
+	8, 153, 43, 53, 227, 166, 80, 7, 63, 26, 43, 174, 158, 153, 136, 151,
+	206, 104, 166, 37, 226, 135, 26, 252, 160, 22, 22, 109, 254, 18, 174, 133,
+	69, 192, 49, 4, 66, 215, 152, 209, 23, 153, 49, 146, 17, 192, 97, 127,
+	186, 40, 146, 139, 212, 249, 10, 62, 2, 55, 55, 240, 78, 215, 79, 137,
+	126, 247, 204, 224, 214, 248, 43, 104, 15, 19, 204, 134, 159, 247, 205, 39,
+	235, 245, 30, 230, 86, 158, 122, 74, 75, 208, 208, 4, 121, 182, 210, 173,
+	223, 114, 5, 102, 29, 53, 21, 96, 71, 130, 5, 234, 18, 114, 174, 178,
+	159, 181, 42, 72, 96, 224, 106, 136, 233, 241, 241, 153, 201, 115, 51, 161,
+	228, 69, 248, 130, 137, 26, 166, 217, 95, 8, 248, 254, 156, 69, 2, 234,
+	3, 117, 118, 167, 58, 98, 90, 211, 18, 146, 146, 35, 4, 33, 13, 181,
+	169, 28, 226, 179, 40, 107, 110, 15, 119, 139, 226, 194, 19, 28, 235, 2,
+	119, 53, 66, 9, 12, 28, 74, 17, 176, 179, 179, 190, 180, 228, 236, 185,
+	146, 43, 31, 87, 188, 68, 221, 182, 111, 1, 31, 214, 157, 43, 71, 90,
+	161, 210, 115, 125, 35, 172, 186, 59, 128, 65, 65, 214, 106, 227, 42, 253,
+	246, 11, 109, 162, 163, 236, 18, 31, 231, 180, 109, 26, 20, 11, 45, 53,
+	213, 146, 71, 211, 21, 210, 170, 249, 34, 96, 96, 75, 218, 38, 203, 241,
+	205, 60, 144, 70, 55, 195, 161, 166, 255, 62, 144, 14, 154, 60, 129, 109,
+	73, 82, 27, 60, 79, 80, 154, 162, 217, 3, 3, 241, 23, 116, 245, 229,
+	128, 101, 138, 119, 150, 178, 105, 112, 215, 189, 138, 50, 21, 101, 104, 133,
+	61, 18, 47, 146, 121, 46, 138, 96, 123, 34, 34, 108, 167, 177, 20, 233,
+	187, 82, 119, 147, 2, 157, 218, 201, 207, 55, 119, 38, 155, 82, 196, 221,
+	108, 207, 163, 255, 251, 73, 250, 20, 50, 197, 197, 152, 144, 208, 137, 205,
+	26, 215, 190, 21, 201, 80, 228, 193, 135, 166, 190, 74, 22, 215, 167, 72,
+	24, 143, 151, 81, 205, 55, 234, 214, 144, 228, 228, 5, 32, 21, 104, 193,
+	33, 224, 67, 241, 93, 127, 87, 120, 159, 44, 67, 94, 152, 224, 11, 16,
+	132, 79, 203, 190, 151, 181, 218, 141, 107, 135, 135, 191, 237, 71, 86, 213,
+	108, 185, 89, 192, 252, 14, 159, 174, 183, 175, 89, 98, 23, 185, 226, 248,
+	240, 15, 255, 16, 161, 203, 202, 79, 201, 166, 166, 34, 93, 130, 183, 217,
+	87, 142, 164, 36, 104, 33, 44, 23, 175, 37, 164, 118, 153, 142, 78, 160,
+	53, 156, 169, 86, 201, 200, 39, 217, 11, 126, 126, 111, 76, 73, 199, 93,
+	164, 249, 189, 55, 194, 67, 28, 225, 186, 216, 189, 231, 24, 249, 54, 38,
+	65, 220, 157, 248, 255, 182, 55, 27, 169, 95, 95, 242, 252, 140, 38, 81,
+	159, 206, 64, 211, 86, 108, 175, 88, 162, 82, 64, 243, 150, 206, 154, 126,
+	221, 28, 193, 23, 165, 52, 7, 64, 82, 60, 60, 72, 49, 222, 24, 69,
+	210, 151, 90, 226, 247, 29, 103, 142, 138, 209, 90, 207, 25, 151, 115, 150,
+	169, 92, 245, 185, 147, 74, 23, 130, 240, 29, 29, 213, 129, 27, 249, 73,
+	233, 160, 167, 6, 99, 50, 212, 55, 146, 91, 167, 219, 151, 160, 223, 206,
+	248, 129, 121, 212, 17, 45, 103, 246, 185, 250, 250, 33, 182, 122, 100, 109,
+	72, 37, 110, 128, 168, 255, 234, 63, 218, 202, 110, 183, 26, 37, 188, 91,
+	140, 193, 77, 122, 39, 83, 119, 52, 27, 219, 219, 188, 6, 191, 133, 97,
+	115, 18, 147, 100, 60, 208, 89, 134, 194, 64, 147, 163, 148, 18, 16, 3,
+	16, 1, 17, 149, 125, 209, 71, 111, 224, 184, 184, 6, 203, 237, 187, 117,
+	62, 75, 137, 85, 157, 161, 145, 80, 234, 195, 137, 159, 27, 75, 249, 235,
+	100, 65, 37, 59, 75, 175, 87, 173, 66, 153, 153, 155, 123, 40, 90, 121,
+	5, 124, 116, 177, 9, 142, 34, 233, 242, 73, 116, 139, 149, 124, 85, 179,
+	178, 166, 20, 79, 100, 31, 167, 135, 114, 107, 107, 243, 165, 47, 156, 61,
+	97, 92, 6, 68, 22, 38, 237, 64, 122, 252, 6, 71, 28, 92, 63, 220,
+	198, 230, 32, 225, 82, 97, 183, 69, 208, 74, 74, 110, 21, 234, 125, 49,
+	90, 107, 251, 160, 130, 9, 94, 249, 98, 118, 251, 83, 146, 107, 147, 132,
+	90, 38, 124, 14, 8, 227, 135, 30, 43, 41, 41, 212, 216, 184, 67, 37,
+	23, 50, 225, 145, 35, 120, 150, 47, 74, 245, 225, 111, 29, 50, 122, 108,
+	46, 102, 72, 160, 62, 157, 151, 220, 137, 8, 8, 73, 104, 125, 162, 41,
+	44, 5, 28, 117, 183, 87, 37, 150, 82, 127, 28, 123, 147, 5, 214, 52,
+	127, 187, 196, 205, 188, 250, 231, 168, 192, 239, 239, 189, 95, 28, 63, 13,
+	141, 128, 213, 243, 124, 154, 27, 158, 26, 238, 213, 23, 30, 128, 181, 161,
+	11, 251, 240, 99, 138, 132, 247, 106, 98, 206, 206, 32, 239, 217, 222, 1,
+	182, 183, 40, 23, 232, 181, 168, 39, 2, 100, 40, 3, 144, 183, 25, 249,
+	151, 59, 172, 140, 208, 6, 199, 49, 153, 173, 173, 154, 34, 139, 224, 21,
+	251, 238, 50, 38, 73, 196, 96, 241, 42, 231, 50, 63, 31, 238, 240, 17,
+	227, 123, 152, 34, 230, 120, 215, 243, 59, 140, 140, 7, 146, 78, 1, 25,
+	192, 217, 207, 194, 221, 235, 211, 72, 50, 109, 207, 43, 145, 217, 92, 73,
+	76, 205, 129, 200, 1, 246, 116, 202, 239, 168, 168, 148, 27, 23, 226, 39,
+	102, 65, 177, 191, 238, 15, 219, 97, 78, 61, 177, 105, 32, 65, 72, 131,
+	56, 141, 181, 102, 55, 136, 100, 8, 77, 137, 137, 9, 171, 210, 3, 43,
+	93, 118, 76, 91, 122, 32, 104, 216, 86, 183, 76, 125, 174, 118, 228, 219,
+	164, 77, 233, 137, 109, 10, 84, 83, 182, 234, 234, 179, 102, 128, 61, 63,
+	16, 47, 86, 106, 219, 81, 160, 14, 126, 52, 86, 65, 33, 47, 13, 51,
+	208, 13, 221, 39, 91, 116, 68, 145, 20, 203, 203, 46, 214, 69, 220, 51,
+	43, 24, 171, 142, 79, 126, 19, 183, 102, 190, 171, 85, 175, 24, 161, 107,
+	129, 208, 81, 74, 217, 19, 52, 229, 93, 44, 44, 218, 225, 36, 65, 23,
+	138, 157, 98, 8, 132, 179, 45, 191, 46, 47, 98, 57, 34, 157, 194, 254,
+	245, 144, 101, 228, 239, 109, 36, 39, 255, 13, 13, 71, 81, 225, 160, 27,
+	177, 170, 159, 236, 16, 156, 158, 6, 54, 165, 159, 45, 172, 170, 110, 166,
+	105, 80, 57, 11, 181, 239, 20, 124, 4, 110, 110, 253, 156, 179, 158, 15,
+	252, 243, 133, 221, 177, 237, 86, 208, 30, 38, 133, 17, 35, 243, 135, 78,
+	29, 16, 13, 165, 131, 145, 4, 190, 166, 79, 79, 96, 44, 118, 127, 3,
+	199, 196, 120, 57, 37, 194, 229, 105, 6, 172, 120, 5, 173, 196, 43, 22,
+	203, 247, 60, 209, 172, 33, 244, 148, 150, 189, 189, 8, 242, 113, 185, 71,
+	163, 228, 10, 204, 58, 106, 42, 192, 142, 25, 10, 201, 36, 228, 65, 121,
+	191, 183, 8, 127, 154, 95, 228, 86, 52, 156, 156, 149, 66, 180, 88, 75,
+	152, 211, 247, 40, 174, 69, 153, 121, 150, 147, 247, 221, 170, 211, 237, 33,
+	35, 119, 84, 144, 192, 221, 212, 13, 207, 255, 255, 47, 143, 230, 102, 95,
+	213, 138, 237, 25, 15, 52, 81, 175, 190, 16, 237, 225, 37, 138, 4, 201,
+	87, 55, 96, 62, 246, 163, 196, 207, 109, 222, 222, 178, 63, 35, 135, 83,
+	238, 189, 16, 253, 155, 27, 226, 22, 166, 154, 16, 245, 171, 189, 168, 145,
+	6, 234, 236, 83, 116, 196, 180, 187, 36, 57, 57, 70, 8, 66, 26, 119,
+	79, 56, 217, 123, 80, 214, 220, 30, 238, 11, 217, 153, 38, 56, 203, 4,
+	114, 170, 216, 253, 66, 186, 164, 121, 134, 24, 24, 219, 184, 135, 251, 123,
+	116, 15, 36, 159, 196, 249, 111, 167, 246, 129, 36, 141, 168, 15, 103, 92,
+	238, 106, 132, 18, 24, 56, 148, 34, 125, 123, 123, 97, 117, 213, 197, 111,
+	57, 86, 62, 174, 101, 136, 167, 113, 222, 2, 62, 177, 39, 86, 142, 180,
+	154, 42, 176, 188, 46, 70, 132, 224, 223, 90, 90, 252, 197, 16, 36, 99,
+	2, 97, 195, 74, 241, 167, 20, 200, 198, 136, 195, 165, 169, 97, 34, 236,
+	95, 185, 230, 250, 70, 69, 105, 118, 29, 130, 130, 177, 212, 219, 84, 231,
+	241, 22, 218, 89, 91, 197, 36, 62, 211, 117, 218, 52, 40, 22, 90, 106,
+	43, 249, 210, 84, 112, 59, 121, 180, 191, 163, 163, 44, 100, 30, 181, 235,
+	202, 33, 39, 189, 207, 234, 151, 135, 203, 255, 39, 32, 166, 33, 246, 50,
+	183, 57, 142, 187, 42, 185, 73, 239, 68, 192, 192, 150, 169, 76, 139, 255,
+	135, 120, 61, 140, 110, 155, 95, 81, 227, 124, 61, 28, 41, 120, 31, 218,
+	195, 121, 186, 21, 28, 199, 89, 45, 230, 225, 225, 11, 25, 137, 106, 243,
+	188, 79, 192, 104, 250, 180, 236, 232, 251, 246, 192, 8, 167, 79, 179, 130,
+	146, 164, 54, 120, 158, 160, 41, 89, 175, 6, 6, 255, 46, 232, 247, 215,
+	29, 202, 9, 238, 49, 121, 210, 224, 179, 103, 9, 100, 42, 202, 208, 23,
+	230, 228, 2, 214, 168, 222, 57, 155, 13, 39, 39, 98, 158, 45, 22, 219,
+	38, 253, 244, 10, 165, 86, 97, 89, 171, 237, 244, 112, 164, 253, 124, 79,
+	122, 36, 94, 57, 242, 92, 9, 192, 246, 68, 68, 216, 83, 127, 40, 207,
+	107, 164, 238, 59, 4, 39, 169, 143, 131, 110, 238, 76, 43, 164, 149, 167,
+	14, 100, 106, 151, 196, 34, 25, 2, 84, 101, 101, 69, 227, 186, 201, 195,
+	80, 147, 19, 223, 144, 8, 26, 54, 155, 228, 19, 88, 165, 147, 57, 255,
+	216, 131, 91, 227, 235, 146, 233, 40, 100, 151, 151, 45, 61, 189, 15, 135,
+	52, 179, 97, 42, 143, 160, 213, 159, 19, 81, 97, 148, 44, 179, 83, 144,
+	172, 195, 111, 77, 221, 236, 249, 234, 198, 182, 182, 176, 141, 120, 238, 139,
+	15, 132, 156, 206, 27, 143, 102, 38, 11, 219, 156, 128, 162, 132, 255, 200,
+	48, 3, 51, 162, 135, 110, 201, 177, 61, 213, 213, 10, 64, 42, 208, 159,
+	66, 221, 134, 255, 186, 254, 174, 240, 35, 88, 134, 188, 45, 221, 22, 32,
+	68, 67, 7, 12, 177, 16, 217, 115, 159, 244, 244, 151, 240, 239, 49, 147,
+	121, 234, 123, 27, 46, 209, 29, 73, 59, 210, 123, 168, 163, 234, 186, 120,
+	21, 158, 139, 97, 51, 119, 169, 7, 214, 19, 19, 99, 199, 142, 172, 183,
+	216, 111, 178, 157, 229, 28, 35, 65, 115, 67, 178, 196, 46, 111, 217, 237,
+	97, 222, 191, 207, 5, 9, 185, 197, 116, 50, 50, 254, 119, 75, 77, 187,
+	227, 88, 79, 121, 113, 51, 144, 248, 107, 201, 79, 208, 160, 88, 117, 181,
+	253, 30, 227, 32, 95, 139, 137, 158, 143, 81, 81, 68, 186, 25, 115, 175,
+	174, 1, 85, 72, 208, 66, 88, 46, 67, 74, 85, 236, 47, 1, 156, 93,
+	137, 94, 215, 142, 105, 245, 153, 92, 45, 112, 112, 217, 10, 220, 146, 163,
+	149, 54, 168, 172, 68, 109, 235, 151, 91, 192, 168, 248, 161, 54, 48, 5,
+	106, 37, 79, 172, 143, 141, 78, 175, 22, 252, 252, 222, 152, 146, 147, 186,
+	85, 239, 103, 110, 153, 134, 56, 223, 105, 173, 103, 211, 48, 239, 108, 76,
+	30, 101, 123, 2, 185, 243, 94, 109, 180, 221, 221, 67, 40, 87, 114, 182,
+	110, 216, 154, 138, 13, 169, 139, 102, 113, 39, 154, 199, 190, 216, 192, 20,
+	130, 165, 39, 237, 227, 113, 110, 54, 79, 190, 190, 249, 229, 5, 76, 162,
+	35, 129, 128, 187, 172, 216, 67, 176, 89, 164, 128, 251, 49, 129, 41, 252,
+	246, 229, 19, 67, 213, 15, 126, 244, 237, 159, 159, 100, 85, 192, 173, 174,
+	24, 182, 125, 95, 56, 247, 240, 9, 65, 46, 125, 239, 191, 182, 133, 164,
+	167, 56, 159, 46, 87, 104, 14, 128, 164, 120, 120, 144, 98, 161, 48, 138,
+	185, 51, 180, 217, 243, 58, 206, 1, 9, 191, 180, 131, 50, 51, 230, 49,
+	211, 120, 171, 128, 97, 22, 30, 66, 6, 89, 89, 13, 210, 100, 209, 134,
+	130, 4, 73, 61, 103, 21, 125, 184, 17, 53, 73, 151, 188, 4, 74, 105,
+	79, 184, 247, 111, 59, 148, 46, 25, 253, 58, 58, 183, 31, 54, 239, 146,
+	207, 93, 83, 12, 198, 100, 181, 110, 57, 182, 83, 171, 51, 93, 163, 129,
+	59, 248, 195, 193, 13, 234, 62, 219, 95, 27, 27, 42, 175, 243, 14, 158,
+	244, 106, 174, 232, 82, 75, 6, 215, 33, 60, 174, 191, 189, 106, 15, 217,
+	237, 31, 242, 181, 34, 90, 206, 241, 111, 233, 233, 66, 113, 244, 200, 218,
+	144, 74, 220, 29, 77, 227, 201, 126, 169, 137, 220, 115, 52, 74, 101, 182,
+	153, 95, 198, 27, 20, 36, 222, 51, 205, 200, 200, 223, 193, 49, 41, 214,
+	171, 125, 33, 249, 217, 204, 122, 199, 177, 3, 33, 103, 186, 125, 201, 238,
+	5, 159, 154, 244, 78, 166, 238, 104, 54, 171, 171, 101, 12, 99, 23, 194,
+	230, 36, 59, 200, 120, 189, 178, 17, 153, 128, 59, 91, 53, 36, 32, 6,
+	113, 223, 174, 90, 120, 216, 254, 170, 148, 138, 138, 248, 188, 166, 246, 206,
+	221, 19, 198, 44, 236, 146, 1, 168, 129, 10, 198, 79, 187, 19, 140, 94,
+	32, 2, 34, 55, 250, 191, 142, 222, 221, 109, 109, 12, 139, 199, 107, 234,
+	124, 150, 15, 170, 39, 95, 63, 160, 201, 155, 15, 35, 54, 150, 239, 203,
+	84, 66, 22, 153, 204, 193, 158, 28, 127, 76, 76, 145, 59, 2, 138, 230,
+	71, 161, 242, 78, 179, 112, 140, 25, 209, 17, 242, 55, 184, 161, 67, 147,
+	200, 130, 74, 118, 150, 67, 174, 71, 132, 47, 47, 43, 246, 80, 180, 242,
+	10, 248, 232, 127, 18, 1, 68, 207, 249, 146, 232, 11, 55, 248, 170, 123,
+	188, 194, 126, 216, 160, 61, 190, 133, 38, 14, 14, 182, 70, 149, 85, 254,
+	49, 207, 21, 155, 134, 46, 247, 118, 225, 24, 21, 31, 185, 207, 6, 35,
+	121, 81, 40, 158, 200, 62, 83, 19, 228, 214, 214, 251, 87, 94, 37, 122,
+	194, 184, 12, 136, 44, 76, 199, 128, 244, 229, 12, 142, 56, 184, 126, 165,
+	13, 17, 28, 48, 254, 64, 67, 209, 70, 247, 247, 102, 231, 155, 196, 118,
+	249, 143, 241, 108, 184, 99, 116, 57, 236, 111, 241, 154, 182, 143, 210, 253,
+	145, 209, 64, 223, 164, 194, 115, 138, 189, 148, 148, 220, 42, 201, 250, 98,
+	180, 214, 235, 93, 25, 18, 188, 239, 196, 236, 235, 166, 57, 214, 59, 21,
+	229, 145, 116, 113, 146, 188, 99, 72, 31, 181, 181, 65, 154, 12, 27, 110,
+	143, 225, 22, 185, 141, 61, 15, 86, 220, 102, 22, 178, 183, 225, 151, 77,
+	180, 76, 248, 28, 16, 219, 19, 60, 86, 82, 82, 181, 173, 109, 134, 74,
+	46, 100, 223, 63, 70, 240, 49, 94, 148, 247, 223, 222, 58, 100, 244, 216,
+	192, 12, 204, 178, 38, 165, 3, 254, 244, 115, 115, 40, 29, 168, 103, 70,
+	21, 83, 34, 219, 210, 223, 130, 231, 140, 125, 34, 202, 180, 83, 88, 128,
+	92, 204, 144, 93, 124, 39, 51, 165, 15, 16, 16, 146, 208, 250, 89, 82,
+	88, 10, 56, 234, 115, 174, 74, 49, 164, 254, 56, 246, 59, 10, 177, 104,
+	40, 140, 164, 243, 74, 89, 35, 103, 173, 49, 49, 15, 96, 63, 184, 94,
+	99, 61, 197, 14, 231, 129, 249, 136, 188, 116, 197, 226, 181, 61, 29, 48,
+	254, 107, 149, 135, 101, 233, 211, 77, 157, 195, 195, 103, 190, 56, 126, 26,
+	7, 29, 183, 251, 248, 41, 54, 33, 52, 193, 183, 46, 60, 29, 119, 95,
+	138, 43, 161, 41, 83, 151, 195, 143, 63, 226, 226, 250, 14, 253, 159, 22,
+	60, 42, 74, 31, 108, 6, 133, 152, 44, 75, 74, 58, 178, 42, 219, 7,
+	22, 235, 253, 198, 9, 21, 243, 212, 196, 129, 129, 64, 195, 175, 161, 2,
+	113, 115, 80, 46, 205, 119, 77, 78, 4, 200, 80, 6, 61, 115, 50, 239,
+	98, 171, 201, 104, 63, 107, 227, 22, 102, 160, 160, 221, 115, 106, 64, 14,
+	74, 68, 173, 202, 89, 88, 254, 247, 28, 66, 173, 18, 179, 68, 158, 183,
+	51, 118, 69, 5, 189, 12, 147, 98, 47, 71, 71, 41, 68, 11, 221, 42,
+	235, 193, 100, 76, 146, 149, 192, 255, 84, 211, 100, 126, 62, 193, 253, 34,
+	71, 54, 113, 171, 139, 114, 131, 160, 141, 102, 102, 180, 244, 206, 60, 38,
+	208, 246, 153, 168, 6, 186, 115, 70, 76, 89, 153, 106, 176, 246, 81, 122,
+	219, 246, 45, 68, 209, 240, 179, 251, 118, 5, 5, 14, 57, 156, 2, 50,
+	157, 175, 131, 153, 167, 203, 187, 144, 100, 218, 131, 86, 63, 175, 184, 146,
+	175, 182, 25, 234, 231, 142, 163, 57, 212, 36, 36, 147, 137, 89, 227, 62,
+	166, 152, 126, 125, 51, 228, 8, 41, 124, 80, 126, 66, 177, 152, 20, 202,
+	152, 135, 31, 141, 2, 241, 232, 137, 195, 77, 77, 53, 54, 46, 217, 78,
+	204, 130, 127, 99, 193, 30, 171, 194, 156, 122, 127, 210, 64, 130, 144, 27,
+	236, 199, 43, 35, 52, 143, 248, 75, 97, 108, 108, 168, 134, 235, 56, 66,
+	247, 181, 130, 135, 85, 49, 24, 123, 132, 240, 130, 198, 206, 181, 60, 67,
+	112, 7, 119, 204, 110, 13, 200, 16, 154, 15, 15, 18, 75, 185, 6, 86,
+	186, 236, 152, 182, 244, 64, 208, 173, 172, 115, 152, 250, 65, 236, 213, 171,
+	4, 71, 67, 98, 88, 115, 216, 210, 56, 46, 46, 143, 251, 124, 231, 90,
+	129, 219, 101, 82, 96, 111, 99, 20, 180, 249, 101, 238, 207, 219, 121, 243,
+	85, 154, 207, 15, 218, 20, 168, 166, 113, 201, 201, 123, 204, 29, 122, 126,
+	32, 94, 172, 212, 171, 162, 93, 28, 252, 104, 172, 130, 66, 94, 26, 102,
+	33, 218, 251, 161, 236, 106, 184, 100, 211, 232, 232, 230, 124, 216, 155, 114,
+	27, 105, 81, 48, 63, 141, 238, 165, 228, 226, 81, 150, 204, 105, 182, 62,
+	189, 26, 167, 78, 182, 232, 136, 63, 40, 139, 139, 92, 177, 138, 165, 102,
+	86, 48, 75, 1, 158, 252, 38, 115, 204, 97, 75, 170, 67, 48, 95, 214,
+	201, 90, 147, 224, 128, 150, 152, 253, 138, 170, 170, 193, 1, 79, 68, 106,
+	109, 7, 182, 229, 10, 211, 149, 202, 212, 235, 182, 190, 205, 7, 243, 142,
+	31, 189, 162, 148, 175, 38, 104, 215, 186, 88, 88, 169, 223, 72, 130, 46,
+	9, 39, 196, 16, 21, 123, 90, 99, 92, 94, 196, 114, 68, 39, 153, 225,
+	107, 253, 150, 58, 153, 88, 120, 21, 24, 121, 121, 52, 111, 141, 99, 34,
+	50, 16, 57, 244, 129, 84, 233, 218, 68, 212, 57, 102, 202, 16, 53, 185,
+	247, 61, 202, 213, 195, 218, 72, 78, 227, 26, 26, 142, 162, 223, 93, 54,
+	127, 73, 35, 197, 32, 37, 33, 12, 108, 87, 35, 90, 69, 73, 220, 81,
+	131, 125, 254, 123, 245, 164, 88, 140, 65, 59, 59, 19, 18, 26, 188, 58,
+	68, 126, 222, 33, 180, 10, 146, 181, 116, 221, 222, 78, 203, 126, 112, 9,
+	210, 160, 114, 22, 119, 195, 40, 248, 8, 220, 220, 231, 37, 123, 33, 30,
+	229, 251, 23, 167, 127, 199, 172, 189, 60, 76, 23, 34, 70, 251, 19, 156,
+	166, 224, 70, 184, 65, 189, 56, 58, 170, 253, 253, 122, 149, 190, 192, 18,
+	222, 204, 234, 67, 235, 232, 31, 4, 36, 198, 234, 54, 200, 204, 191, 196,
+	58, 32, 26, 87, 27, 63, 8, 97, 81, 158, 158, 192, 88, 236, 254, 6,
+	147, 149, 240, 114, 74, 153, 215, 210, 12, 69, 240, 10, 71, 149, 86, 44,
+	78, 96, 46, 249, 45, 65, 24, 163, 243, 191, 191, 93, 232, 41, 31, 10,
+	168, 162, 13, 150, 222, 182, 100, 107, 20, 207, 13, 30, 201, 162, 250, 116,
+	139, 243, 120, 191, 69, 66, 245, 53, 49, 103, 103, 16, 249, 226, 111, 142,
+	91, 213, 20, 133, 116, 212, 84, 157, 1, 50, 20, 143, 72, 213, 130, 242,
+	255, 179, 76, 17, 115, 60, 229, 247, 147, 70, 70, 141, 73, 39, 142, 130,
+	96, 226, 233, 97, 224, 251, 231, 36, 25, 184, 233, 155, 198, 226, 46, 170,
+	99, 115, 16, 254, 41, 190, 213, 172, 104, 37, 37, 55, 132, 117, 176, 150,
+	45, 187, 243, 80, 65, 138, 47, 242, 49, 59, 243, 167, 73, 187, 199, 66,
+	23, 51, 36, 80, 31, 192, 197, 110, 202, 4, 4, 170, 52, 176, 81, 154,
+	22, 140, 14, 180, 213, 165, 156, 75, 41, 177, 14, 179, 199, 140, 107, 26,
+	70, 238, 168, 61, 157, 167, 181, 26, 131, 227, 227, 94, 3, 209, 204, 190,
+	183, 9, 199, 50, 30, 104, 162, 67, 97, 32, 199, 223, 74, 9, 8, 143,
+	50, 174, 156, 147, 171, 217, 165, 216, 33, 194, 194, 195, 179, 20, 45, 178,
+	140, 62, 58, 214, 138, 71, 17, 250, 121, 170, 58, 203, 196, 62, 164, 215,
+	174, 110, 192, 124, 241, 91, 149, 131, 218, 161, 161, 121, 126, 70, 19, 166,
+	193, 103, 32, 231, 43, 54, 217, 44, 81, 41, 32, 247, 75, 103, 77, 63,
+	218, 46, 244, 210, 199, 37, 133, 65, 120, 128, 128, 228, 206, 131, 242, 170,
+	250, 80, 221, 3, 191, 25, 106, 149, 73, 163, 221, 227, 197, 80, 225, 103,
+	12, 201, 197, 166, 232, 149, 117, 107, 72, 114, 114, 140, 16, 132, 52, 238,
+	158, 112, 175, 246, 160, 177, 165, 60, 193, 22, 175, 47, 76, 112, 139, 8,
+	120, 137, 241, 8, 222, 235, 101, 169, 234, 83, 83, 17, 160, 65, 213, 226,
+	165, 71, 82, 18, 52, 158, 22, 133, 217, 156, 82, 59, 194, 71, 39, 80,
+	228, 73, 173, 231, 132, 105, 85, 242, 17, 48, 48, 171, 109, 19, 235, 246,
+	232, 30, 72, 35, 149, 239, 222, 83, 241, 31, 72, 7, 77, 30, 206, 184,
+	144, 9, 153, 73, 178, 23, 69, 48, 179, 17, 17, 54, 221, 214, 10, 250,
+	211, 41, 181, 199, 1, 192, 109, 234, 233, 149, 181, 19, 195, 41, 98, 224,
+	193, 212, 21, 36, 48, 112, 53, 68, 250, 246, 246, 194, 234, 183, 151, 222,
+	114, 172, 124, 65, 202, 13, 83, 226, 161, 4, 124, 127, 78, 172, 1, 117,
+	181, 148, 33, 138, 6, 14, 37, 134, 88, 215, 215, 95, 90, 114, 118, 210,
+	73, 155, 129, 165, 94, 34, 224, 91, 185, 142, 129, 107, 192, 155, 173, 45,
+	41, 84, 125, 101, 92, 140, 21, 221, 163, 180, 180, 229, 151, 32, 72, 198,
+	4, 194, 155, 148, 255, 83, 40, 141, 145, 13, 155, 87, 79, 194, 68, 197,
+	93, 20, 73, 203, 106, 242, 5, 31, 1, 149, 149, 120, 39, 229, 169, 202,
+	63, 245, 102, 112, 107, 124, 155, 52, 137, 135, 102, 67, 193, 245, 232, 157,
+	190, 111, 209, 233, 140, 138, 210, 236, 58, 25, 25, 127, 181, 171, 168, 211,
+	255, 44, 169, 178, 182, 151, 72, 124, 187, 234, 169, 104, 80, 44, 180, 212,
+	202, 47, 229, 71, 186, 244, 194, 46, 152, 56, 56, 226, 5, 110, 73, 223,
+	196, 27, 84, 86, 34, 184, 251, 197, 163, 96, 84, 124, 222, 27, 24, 140,
+	86, 239, 185, 168, 224, 118, 242, 117, 99, 91, 91, 88, 200, 60, 119, 203,
+	137, 66, 78, 103, 131, 201, 51, 19, 139, 227, 78, 64, 81, 66, 241, 100,
+	34, 175, 141, 6, 214, 8, 226, 183, 193, 122, 122, 197, 120, 249, 150, 199,
+	178, 117, 179, 131, 23, 230, 128, 170, 147, 105, 179, 84, 223, 117, 93, 60,
+	115, 114, 1, 107, 84, 111, 146, 195, 136, 157, 157, 49, 79, 152, 11, 227,
+	19, 240, 122, 5, 220, 43, 190, 162, 219, 248, 122, 56, 82, 240, 62, 169,
+	7, 50, 53, 197, 98, 17, 130, 1, 42, 188, 188, 172, 255, 93, 234, 239,
+	40, 199, 135, 225, 72, 4, 13, 27, 195, 114, 135, 44, 220, 199, 146, 241,
+	155, 242, 105, 42, 56, 147, 178, 90, 209, 223, 223, 22, 50, 15, 212, 251,
+	101, 158, 157, 208, 233, 117, 197, 205, 235, 241, 157, 16, 83, 158, 123, 25,
+	239, 178, 93, 132, 14, 237, 162, 152, 115, 254, 254, 139, 130, 202, 53, 247,
+	94, 169, 96, 52, 125, 90, 118, 116, 243, 123, 96, 4, 221, 169, 215, 65,
+	57, 85, 108, 240, 33, 93, 82, 178, 67, 12, 12, 227, 92, 205, 243, 179,
+	58, 137, 18, 193, 98, 242, 185, 221, 123, 206, 18, 200, 84, 137, 189, 46,
+	77, 21, 88, 94, 23, 35, 66, 112, 225, 45, 45, 126, 236, 8, 18, 191,
+	1, 190, 239, 37, 246, 221, 10, 100, 99, 68, 239, 220, 218, 190, 17, 118,
+	209, 213, 4, 177, 77, 161, 114, 43, 26, 78, 78, 196, 33, 90, 44, 171,
+	76, 231, 245, 20, 87, 172, 194, 178, 75, 199, 245, 224, 85, 231, 248, 158,
+	165, 149, 48, 31, 123, 223, 98, 233, 184, 111, 111, 89, 145, 159, 205, 167,
+	119, 208, 8, 240, 195, 131, 113, 11, 83, 77, 8, 244, 219, 208, 84, 198,
+	244, 72, 188, 114, 249, 184, 18, 157, 241, 136, 136, 173, 166, 254, 80, 131,
+	214, 85, 193, 118, 8, 78, 79, 3, 27, 220, 193, 152, 86, 85, 55, 83,
+	128, 8, 136, 220, 207, 198, 2, 95, 83, 169, 169, 48, 22, 59, 177, 143,
+	237, 98, 60, 146, 156, 97, 252, 186, 3, 86, 60, 140, 216, 98, 155, 11,
+	28, 200, 212, 51, 149, 68, 50, 4, 168, 202, 202, 138, 219, 105, 143, 155,
+	160, 59, 38, 163, 61, 16, 52, 108, 43, 213, 38, 176, 87, 59, 114, 227,
+	104, 136, 224, 157, 163, 58, 34, 198, 10, 235, 235, 23, 107, 172, 110, 151,
+	155, 12, 219, 71, 169, 63, 135, 213, 51, 95, 219, 164, 217, 12, 222, 187,
+	173, 27, 182, 219, 203, 57, 207, 80, 200, 51, 51, 90, 122, 103, 30, 19,
+	104, 123, 194, 84, 3, 93, 183, 35, 38, 162, 194, 53, 88, 123, 166, 61,
+	217, 91, 130, 117, 253, 71, 223, 146, 106, 18, 18, 199, 202, 162, 255, 31,
+	83, 76, 63, 176, 151, 114, 4, 154, 62, 40, 63, 33, 214, 76, 10, 101,
+	69, 155, 222, 154, 167, 197, 239, 201, 145, 113, 113, 125, 7, 240, 193, 11,
+	30, 21, 37, 129, 54, 3, 204, 76, 22, 171, 37, 29, 89, 21, 227, 141,
+	49, 219, 234, 52, 145, 187, 255, 11, 51, 80, 80, 224, 183, 53, 32, 7,
+	37, 34, 216, 101, 162, 44, 127, 245, 14, 33, 216, 9, 215, 34, 79, 213,
+	96, 6, 102, 89, 19, 220, 143, 127, 122, 183, 183, 20, 128, 84, 189, 35,
+	132, 167, 17, 227, 105, 225, 65, 253, 70, 176, 17, 101, 90, 167, 44, 64,
+	20, 70, 82, 247, 37, 162, 159, 189, 216, 150, 150, 137, 48, 145, 92, 47,
+	191, 144, 236, 7, 253, 206, 242, 68, 94, 58, 236, 113, 212, 144, 128, 24,
+	136, 134, 14, 24, 127, 32, 175, 230, 35, 245, 245, 51, 253, 195, 98, 59,
+	242, 201, 246, 54, 92, 191, 58, 146, 118, 185, 246, 77, 91, 201, 105, 240,
+	252, 198, 58, 182, 73, 94, 191, 36, 129, 212, 212, 174, 77, 6, 131, 55,
+	201, 254, 11, 210, 200, 144, 137, 43, 110, 51, 11, 89, 213, 254, 197, 168,
+	42, 33, 11, 194, 102, 238, 79, 14, 177, 38, 38, 198, 147, 1, 69, 115,
+	173, 222, 121, 39, 215, 56, 70, 130, 230, 134, 121, 149, 92, 222, 175, 199,
+	94, 97, 63, 108, 80, 144, 95, 204, 19, 7, 7, 91, 35, 196, 164, 127,
+	150, 233, 132, 195, 67, 23, 245, 59, 254, 12, 132, 129, 210, 233, 3, 159,
+	194, 161, 99, 131, 10, 18, 111, 151, 232, 100, 100, 225, 238, 150, 154, 107,
+	219, 176, 158, 242, 226, 102, 61, 237, 214, 143, 158, 189, 93, 176, 234, 119,
+	182, 225, 87, 45, 60, 108, 127, 85, 74, 69, 69, 124, 94, 83, 123, 103,
+	224, 135, 99, 22, 118, 73, 142, 84, 206, 5, 99, 169, 211, 135, 70, 47,
+	231, 60, 219, 64, 190, 11, 15, 33, 3, 162, 162, 136, 105, 50, 230, 67,
+	65, 2, 170, 144, 189, 132, 176, 92, 134, 148, 170, 197, 94, 2, 37, 186,
+	147, 124, 239, 238, 136, 117, 31, 227, 161, 131, 131, 21, 217, 247, 7, 79,
+	122, 53, 87, 116, 41, 171, 3, 229, 158, 30, 87, 209, 208, 53, 137, 226,
+	15, 188, 179, 1, 210, 247, 47, 184, 90, 224, 224, 175, 20, 165, 57, 91,
+	55, 108, 77, 69, 136, 218, 203, 51, 182, 157, 77, 237, 95, 108, 96, 10,
+	123, 252, 135, 175, 228, 137, 63, 122, 248, 193, 193, 50, 164, 96, 216, 87,
+	12, 91, 176, 161, 28, 245, 120, 138, 174, 23, 176, 249, 209, 91, 204, 82,
+	212, 74, 158, 69, 3, 7, 156, 67, 44, 229, 229, 161, 45, 57, 59, 105,
+	170, 195, 206, 220, 47, 17, 112, 163, 210, 71, 206, 187, 96, 195, 216, 152,
+	160, 10, 170, 235, 53, 121, 140, 129, 142, 196, 196, 60, 157, 252, 218, 101,
+	145, 244, 51, 56, 187, 62, 195, 26, 202, 205, 51, 175, 238, 244, 116, 192,
+	60, 202, 246, 4, 111, 251, 188, 218, 117, 167, 167, 134, 80, 174, 228, 113,
+	220, 173, 41, 9, 26, 79, 11, 204, 226, 78, 41, 147, 97, 173, 157, 40,
+	72, 138, 194, 170, 89, 133, 172, 24, 215, 134, 134, 27, 224, 107, 5, 125,
+	231, 154, 212, 237, 142, 96, 184, 117, 250, 196, 212, 135, 239, 154, 49, 112,
+	25, 87, 78, 199, 219, 226, 220, 108, 158, 97, 97, 239, 215, 10, 152, 89,
+	70, 31, 29, 107, 69, 173, 134, 125, 178, 85, 29, 235, 98, 31, 82, 229,
+	109, 23, 122, 105, 237, 156, 204, 174, 60, 64, 64, 114, 103, 207, 121, 85,
+	125, 40, 224, 143, 209, 130, 53, 196, 170, 223, 224, 255, 236, 40, 254, 189,
+	241, 215, 38, 134, 183, 30, 252, 245, 199, 35, 35, 200, 170, 157, 71, 65,
+	48, 113, 250, 190, 112, 243, 253, 18, 130, 92, 250, 195, 99, 113, 23, 85,
+	133, 151, 18, 40, 129, 96, 236, 55, 101, 2, 2, 85, 26, 88, 166, 77,
+	11, 70, 7, 90, 228, 220, 78, 171, 154, 214, 7, 215, 237, 70, 187, 13,
+	83, 112, 35, 92, 174, 208, 28, 29, 85, 240, 240, 61, 196, 95, 96, 9,
+	111, 102, 117, 175, 251, 116, 129, 2, 18, 99, 117, 27, 100, 102, 209, 98,
+	39, 48, 23, 242, 152, 174, 12, 223, 247, 209, 209, 160, 116, 154, 129, 5,
+	84, 81, 136, 75, 111, 91, 50, 187, 10, 233, 136, 15, 234, 81, 125, 58,
+	187, 240, 75, 29, 194, 44, 60, 132, 12, 178, 178, 26, 185, 200, 191, 17,
+	25, 8, 146, 122, 206, 42, 250, 109, 34, 106, 146, 51, 101, 8, 148, 210,
+	207, 176, 127, 179, 244, 82, 44, 70, 174, 147, 147, 135, 9, 13, 94, 29,
+	34, 63, 111, 158, 90, 5, 73, 212, 58, 224, 111, 39, 235, 63, 56, 138,
+	158, 109, 243, 222, 118, 53, 92, 50, 231, 116, 116, 115, 62, 108, 195, 57,
+	131, 186, 166, 24, 145, 200, 119, 220, 114, 113, 166, 75, 102, 186, 91, 31,
+	234, 45, 199, 112, 64, 75, 76, 240, 69, 85, 85, 238, 142, 169, 34, 53,
+	184, 141, 91, 252, 5, 231, 196, 101, 106, 251, 91, 95, 232, 141, 247, 71,
+	118, 237, 155, 159, 26, 201, 124, 171, 190, 54, 54, 84, 67, 251, 28, 33,
+	245, 212, 65, 205, 164, 150, 12, 179, 66, 120, 65, 99, 103, 212, 30, 175,
+	2, 173, 175, 49, 44, 183, 108, 105, 28, 23, 23, 201, 243, 62, 253, 45,
+	206, 227, 188, 41, 48, 185, 191, 10, 90, 242, 188, 119, 233, 227, 178, 247,
+	199, 62, 249, 119, 68, 180, 129, 255, 222, 207, 207, 132, 226, 245, 141, 169,
+	61, 148, 165, 58, 154, 219, 143, 252, 79, 15, 165, 230, 104, 148, 202, 113,
+	179, 126, 205, 217, 114, 202, 145, 61, 124, 238, 238, 25, 82, 48, 108, 165,
+	6, 163, 88, 222, 14, 244, 60, 69, 87, 133, 88, 242, 230, 163, 102, 41,
+	47, 190, 145, 54, 40, 72, 161, 102, 135, 141, 141, 163, 159, 98, 82, 177,
+	75, 250, 66, 239, 175, 133, 244, 147, 127, 6, 66, 206, 105, 250, 143, 193,
+	91, 254, 165, 152, 30, 54, 177, 164, 37, 172, 172, 62, 47, 167, 179, 189,
+	112, 205, 191, 11, 59, 170, 71, 42, 103, 140, 191, 218, 231, 205, 35, 153,
+	10, 35, 41, 245, 156, 81, 193, 208, 108, 75, 75, 202, 24, 198, 46, 153,
+	209, 72, 118, 141, 240, 103, 121, 34, 47, 29, 118, 182, 106, 72, 64, 12,
+	126, 99, 29, 91, 170, 47, 209, 18, 206, 106, 106, 87, 168, 3, 207, 149,
+	234, 127, 139, 105, 100, 72, 202, 155, 55, 151, 139, 162, 228, 127, 236, 84,
+	226, 163, 65, 180, 240, 173, 225, 73, 53, 9, 9, 237, 101, 81, 241, 129,
+	167, 38, 145, 88, 197, 57, 2, 77, 31, 20, 145, 158, 107, 38, 5, 188,
+	150, 227, 117, 26, 198, 211, 241, 139, 151, 40, 40, 112, 213, 148, 16, 141,
+	156, 17, 108, 188, 81, 22, 177, 244, 7, 158, 108, 138, 229, 17, 169, 228,
+	64, 4, 68, 110, 233, 99, 1, 161, 167, 218, 218, 24, 11, 147, 214, 201,
+	248, 49, 30, 73, 78, 190, 126, 93, 143, 43, 30, 70, 108, 49, 195, 139,
+	52, 68, 112, 192, 223, 29, 17, 99, 5, 251, 251, 133, 187, 86, 55, 197,
+	195, 6, 227, 173, 218, 145, 205, 228, 151, 161, 227, 82, 226, 6, 111, 211,
+	168, 132, 44, 47, 133, 159, 33, 56, 254, 152, 152, 63, 118, 4, 9, 209,
+	142, 95, 249, 156, 123, 224, 5, 50, 191, 34, 249, 110, 109, 95, 134, 59,
+	220, 196, 24, 129, 179, 225, 49, 250, 92, 185, 185, 162, 198, 193, 232, 221,
+	181, 104, 4, 120, 239, 207, 182, 139, 167, 168, 4, 122, 227, 104, 42, 99,
+	141, 25, 148, 236, 49, 134, 65, 142, 21, 94, 94, 86, 241, 160, 117, 249,
+	20, 237, 205, 254, 36, 2, 136, 131, 239, 57, 205, 22, 110, 237, 73, 246,
+	249, 89, 160, 66, 7, 248, 81, 76, 183, 127, 127, 203, 65, 101, 148, 245,
+	47, 218, 48, 26, 176, 45, 59, 58, 247, 179, 48, 2, 224, 218, 229, 174,
+	101, 153, 252, 173, 93, 122, 97, 23, 76, 28, 28, 113, 140, 55, 170, 225,
+	98, 131, 42, 43, 17, 92, 243, 236, 223, 48, 42, 62, 111, 131, 12, 70,
+	17, 217, 200, 3, 107, 4, 113, 213, 238, 61, 61, 236, 60, 242, 75, 237,
+	89, 180, 215, 207, 133, 115, 64, 85, 199, 186, 215, 42, 225, 180, 160, 30,
+	242, 162, 80, 33, 141, 124, 166, 38, 213, 177, 177, 235, 174, 188, 74, 244,
+	153, 109, 24, 13, 88, 152, 147, 29, 245, 215, 24, 1, 112, 109, 252, 87,
+	134, 226, 100, 143, 187, 2, 182, 228, 119, 144, 144, 118, 30, 121, 171, 248,
+	162, 90, 229, 233, 204, 183, 32, 164, 237, 93, 229, 21, 254, 90, 80, 15,
+	26, 34, 56, 96, 225, 128, 134, 191, 140, 243, 243, 204, 211, 43, 149, 236,
+	239, 3, 255, 216, 109, 198, 232, 114, 197, 222, 255, 41, 113, 3, 185, 231,
+	110, 98, 12, 206, 215, 254, 150, 125, 46, 210, 210, 81, 99, 238, 116, 224,
+	212, 52, 2, 60, 249, 233, 91, 203, 221, 84, 2, 61, 255, 52, 21, 191,
+	63, 191, 128, 163, 85, 153, 230, 9, 103, 53, 53, 165, 84, 143, 233, 196,
+	117, 177, 203, 186, 50, 36, 101, 195, 149, 197, 203, 81, 114, 177, 118, 42,
+	75, 255, 180, 13, 99, 231, 246, 203, 197, 20, 20, 56, 228, 74, 8, 200,
+	78, 134, 54, 94, 166, 11, 214, 122, 141, 79, 54, 69, 252, 134, 218, 114,
+	215, 63, 232, 226, 57, 101, 198, 144, 62, 119, 119, 130, 41, 24, 54, 220,
+	3, 223, 44, 111, 7, 122, 30, 172, 165, 204, 44, 121, 115, 223, 51, 154,
+	163, 127, 220, 76, 15, 27, 214, 82, 156, 86, 86, 31, 153, 221, 215, 208,
+	56, 232, 209, 139, 147, 85, 173, 21, 189, 70, 209, 109, 253, 232, 159, 194,
+	117, 152, 237, 56, 32, 171, 38, 120, 172, 164, 164, 119, 71, 218, 17, 148,
+	92, 200, 163, 126, 140, 253, 98, 188, 53, 243, 163, 161, 116, 200, 245, 173,
+	1, 216, 217, 150, 22, 213, 54, 186, 14, 133, 133, 234, 247, 31, 240, 152,
+	103, 255, 94, 154, 24, 210, 209, 5, 45, 121, 94, 181, 250, 255, 89, 245,
+	157, 24, 133, 121, 76, 87, 6, 225, 245, 230, 230, 80, 58, 77, 206, 140,
+	42, 166, 68, 171, 185, 163, 25, 211, 5, 250, 68, 137, 117, 166, 176, 29,
+	233, 88, 177, 215, 122, 41, 22, 35, 87, 199, 199, 205, 138, 136, 47, 128,
+	17, 145, 185, 79, 45, 140, 170, 106, 29, 112, 185, 157, 251, 145, 28, 69,
+	184, 133, 61, 186, 248, 78, 102, 87, 30, 32, 32, 57, 189, 233, 178, 164,
+	176, 20, 112, 201, 230, 65, 148, 98, 85, 225, 112, 241, 118, 20, 127, 208,
+	204, 197, 9, 20, 206, 48, 118, 149, 188, 1, 1, 164, 13, 44, 83, 168,
+	139, 35, 141, 45, 114, 110, 39, 219, 77, 107, 141, 229, 248, 35, 211, 136,
+	80, 5, 85, 251, 148, 178, 70, 206, 71, 98, 98, 30, 192, 126, 109, 188,
+	198, 122, 151, 28, 211, 31, 239, 13, 101, 232, 151, 217, 119, 122, 58, 96,
+	36, 69, 97, 85, 162, 204, 86, 12, 229, 67, 67, 131, 112, 187, 140, 176,
+	253, 77, 106, 248, 71, 48, 92, 180, 125, 98, 106, 205, 249, 77, 150, 56,
+	225, 214, 55, 19, 202, 207, 187, 154, 39, 155, 155, 206, 97, 112, 252, 52,
+	14, 58, 115, 235, 237, 82, 108, 66, 104, 159, 115, 92, 120, 58, 238, 190,
+	149, 150, 3, 189, 252, 177, 171, 88, 133, 186, 186, 83, 209, 181, 29, 56,
+	53, 13, 142, 15, 121, 125, 223, 251, 112, 21, 142, 72, 246, 13, 66, 230,
+	9, 86, 95, 82, 166, 51, 155, 3, 126, 217, 217, 233, 28, 231, 35, 44,
+	120, 84, 148, 62, 216, 12, 23, 45, 88, 150, 148, 116, 121, 84, 171, 14,
+	125, 22, 107, 252, 144, 77, 139, 193, 220, 248, 248, 116, 172, 34, 194, 32,
+	67, 99, 105, 218, 76, 35, 164, 148, 64, 28, 105, 96, 247, 99, 7, 86,
+	44, 203, 231, 145, 18, 42, 251, 181, 149, 31, 31, 128, 155, 67, 95, 4,
+	226, 230, 160, 92, 135, 238, 154, 156, 8, 141, 160, 12, 122, 230, 100, 195,
+	88, 139, 211, 63, 36, 84, 235, 119, 55, 62, 62, 29, 43, 134, 190, 8,
+	217, 209, 93, 184, 19, 193, 41, 37, 16, 7, 93, 24, 244, 209, 200, 155,
+	196, 75, 143, 208, 126, 214, 219, 44, 204, 93, 93, 167, 230, 212, 128, 28,
+	148, 136, 71, 137, 178, 176, 225, 243, 56, 132, 71, 36, 123, 136, 33, 115,
+	176, 11, 187, 126, 72, 168, 203, 238, 110, 124, 124, 58, 86, 17, 97, 16,
+	175, 191, 186, 109, 38, 159, 82, 74, 32, 14, 186, 48, 245, 191, 141, 43,
+	102, 236, 138, 10, 103, 24, 59, 196, 94, 142, 142, 82, 136, 22, 167, 84,
+	203, 159, 200, 152, 57, 55, 157, 227, 168, 187, 200, 252, 124, 159, 231, 68,
+	18, 172, 190, 164, 81, 102, 43, 6, 252, 175, 175, 207, 56, 211, 70, 88,
+	240, 168, 53, 124, 173, 24, 46, 90, 176, 49, 53, 232, 242, 168, 75, 28,
+	142, 108, 226, 75, 11, 228, 27, 93, 7, 204, 204, 117, 245, 129, 120, 76,
+	189, 241, 47, 77, 12, 105, 230, 140, 152, 178, 47, 212, 125, 241, 162, 244,
+	250, 44, 214, 229, 61, 154, 11, 159, 165, 237, 237, 232, 69, 68, 153, 64,
+	134, 198, 210, 169, 152, 70, 85, 53, 128, 56, 210, 192, 243, 198, 14, 172,
+	171, 241, 90, 136, 191, 253, 123, 235, 236, 10, 10, 28, 114, 37, 4, 100,
+	39, 67, 27, 47, 83, 139, 107, 61, 200, 169, 27, 172, 126, 67, 109, 57,
+	223, 177, 110, 38, 137, 131, 107, 41, 78, 43, 43, 129, 194, 224, 229, 104,
+	28, 116, 230, 203, 199, 164, 216, 132, 208, 35, 230, 184, 240, 116, 193, 97,
+	67, 113, 50, 201, 211, 1, 91, 114, 181, 72, 72, 59, 15, 178, 219, 124,
+	81, 45, 252, 250, 102, 213, 16, 82, 248, 160, 252, 132, 127, 45, 40, 137,
+	55, 49, 6, 103, 229, 127, 75, 176, 23, 105, 105, 166, 191, 119, 58, 112,
+	106, 26, 1, 30, 242, 250, 163, 235, 224, 42, 1, 144, 241, 26, 132, 209,
+};
+
+static const uint8_t rs2_fixed_285_0_255_223_mulroot[8192] = {
+	0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+	16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+	32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+	48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+	64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+	80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,
+	96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+	112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127,
+	128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143,
+	144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159,
+	160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175,
+	176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191,
+	192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207,
+	208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223,
+	224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239,
+	240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255,
+	0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30,
+	32, 34, 36, 38, 40, 42, 44, 46, 48, 50, 52, 54, 56, 58, 60, 62,
+	64, 66, 68, 70, 72, 74, 76, 78, 80, 82, 84, 86, 88, 90, 92, 94,
+	96, 98, 100, 102, 104, 106, 108, 110, 112, 114, 116, 118, 120, 122, 124, 126,
+	128, 130, 132, 134, 136, 138, 140, 142, 144, 146, 148, 150, 152, 154, 156, 158,
+	160, 162, 164, 166, 168, 170, 172, 174, 176, 178, 180, 182, 184, 186, 188, 190,
+	192, 194, 196, 198, 200, 202, 204, 206, 208, 210, 212, 214, 216, 218, 220, 222,
+	224, 226, 228, 230, 232, 234, 236, 238, 240, 242, 244, 246, 248, 250, 252, 254,
+	29, 31, 25, 27, 21, 23, 17, 19, 13, 15, 9, 11, 5, 7, 1, 3,
+	61, 63, 57, 59, 53, 55, 49, 51, 45, 47, 41, 43, 37, 39, 33, 35,
+	93, 95, 89, 91, 85, 87, 81, 83, 77, 79, 73, 75, 69, 71, 65, 67,
+	125, 127, 121, 123, 117, 119, 113, 115, 109, 111, 105, 107, 101, 103, 97, 99,
+	157, 159, 153, 155, 149, 151, 145, 147, 141, 143, 137, 139, 133, 135, 129, 131,
+	189, 191, 185, 187, 181, 183, 177, 179, 173, 175, 169, 171, 165, 167, 161, 163,
+	221, 223, 217, 219, 213, 215, 209, 211, 205, 207, 201, 203, 197, 199, 193, 195,
+	253, 255, 249, 251, 245, 247, 241, 243, 237, 239, 233, 235, 229, 231, 225, 227,
+	0, 4, 8, 12, 16, 20, 24, 28, 32, 36, 40, 44, 48, 52, 56, 60,
+	64, 68, 72, 76, 80, 84, 88, 92, 96, 100, 104, 108, 112, 116, 120, 124,
+	128, 132, 136, 140, 144, 148, 152, 156, 160, 164, 168, 172, 176, 180, 184, 188,
+	192, 196, 200, 204, 208, 212, 216, 220, 224, 228, 232, 236, 240, 244, 248, 252,
+	29, 25, 21, 17, 13, 9, 5, 1, 61, 57, 53, 49, 45, 41, 37, 33,
+	93, 89, 85, 81, 77, 73, 69, 65, 125, 121, 117, 113, 109, 105, 101, 97,
+	157, 153, 149, 145, 141, 137, 133, 129, 189, 185, 181, 177, 173, 169, 165, 161,
+	221, 217, 213, 209, 205, 201, 197, 193, 253, 249, 245, 241, 237, 233, 229, 225,
+	58, 62, 50, 54, 42, 46, 34, 38, 26, 30, 18, 22, 10, 14, 2, 6,
+	122, 126, 114, 118, 106, 110, 98, 102, 90, 94, 82, 86, 74, 78, 66, 70,
+	186, 190, 178, 182, 170, 174, 162, 166, 154, 158, 146, 150, 138, 142, 130, 134,
+	250, 254, 242, 246, 234, 238, 226, 230, 218, 222, 210, 214, 202, 206, 194, 198,
+	39, 35, 47, 43, 55, 51, 63, 59, 7, 3, 15, 11, 23, 19, 31, 27,
+	103, 99, 111, 107, 119, 115, 127, 123, 71, 67, 79, 75, 87, 83, 95, 91,
+	167, 163, 175, 171, 183, 179, 191, 187, 135, 131, 143, 139, 151, 147, 159, 155,
+	231, 227, 239, 235, 247, 243, 255, 251, 199, 195, 207, 203, 215, 211, 223, 219,
+	0, 8, 16, 24, 32, 40, 48, 56, 64, 72, 80, 88, 96, 104, 112, 120,
+	128, 136, 144, 152, 160, 168, 176, 184, 192, 200, 208, 216, 224, 232, 240, 248,
+	29, 21, 13, 5, 61, 53, 45, 37, 93, 85, 77, 69, 125, 117, 109, 101,
+	157, 149, 141, 133, 189, 181, 173, 165, 221, 213, 205, 197, 253, 245, 237, 229,
+	58, 50, 42, 34, 26, 18, 10, 2, 122, 114, 106, 98, 90, 82, 74, 66,
+	186, 178, 170, 162, 154, 146, 138, 130, 250, 242, 234, 226, 218, 210, 202, 194,
+	39, 47, 55, 63, 7, 15, 23, 31, 103, 111, 119, 127, 71, 79, 87, 95,
+	167, 175, 183, 191, 135, 143, 151, 159, 231, 239, 247, 255, 199, 207, 215, 223,
+	116, 124, 100, 108, 84, 92, 68, 76, 52, 60, 36, 44, 20, 28, 4, 12,
+	244, 252, 228, 236, 212, 220, 196, 204, 180, 188, 164, 172, 148, 156, 132, 140,
+	105, 97, 121, 113, 73, 65, 89, 81, 41, 33, 57, 49, 9, 1, 25, 17,
+	233, 225, 249, 241, 201, 193, 217, 209, 169, 161, 185, 177, 137, 129, 153, 145,
+	78, 70, 94, 86, 110, 102, 126, 118, 14, 6, 30, 22, 46, 38, 62, 54,
+	206, 198, 222, 214, 238, 230, 254, 246, 142, 134, 158, 150, 174, 166, 190, 182,
+	83, 91, 67, 75, 115, 123, 99, 107, 19, 27, 3, 11, 51, 59, 35, 43,
+	211, 219, 195, 203, 243, 251, 227, 235, 147, 155, 131, 139, 179, 187, 163, 171,
+	0, 16, 32, 48, 64, 80, 96, 112, 128, 144, 160, 176, 192, 208, 224, 240,
+	29, 13, 61, 45, 93, 77, 125, 109, 157, 141, 189, 173, 221, 205, 253, 237,
+	58, 42, 26, 10, 122, 106, 90, 74, 186, 170, 154, 138, 250, 234, 218, 202,
+	39, 55, 7, 23, 103, 119, 71, 87, 167, 183, 135, 151, 231, 247, 199, 215,
+	116, 100, 84, 68, 52, 36, 20, 4, 244, 228, 212, 196, 180, 164, 148, 132,
+	105, 121, 73, 89, 41, 57, 9, 25, 233, 249, 201, 217, 169, 185, 137, 153,
+	78, 94, 110, 126, 14, 30, 46, 62, 206, 222, 238, 254, 142, 158, 174, 190,
+	83, 67, 115, 99, 19, 3, 51, 35, 211, 195, 243, 227, 147, 131, 179, 163,
+	232, 248, 200, 216, 168, 184, 136, 152, 104, 120, 72, 88, 40, 56, 8, 24,
+	245, 229, 213, 197, 181, 165, 149, 133, 117, 101, 85, 69, 53, 37, 21, 5,
+	210, 194, 242, 226, 146, 130, 178, 162, 82, 66, 114, 98, 18, 2, 50, 34,
+	207, 223, 239, 255, 143, 159, 175, 191, 79, 95, 111, 127, 15, 31, 47, 63,
+	156, 140, 188, 172, 220, 204, 252, 236, 28, 12, 60, 44, 92, 76, 124, 108,
+	129, 145, 161, 177, 193, 209, 225, 241, 1, 17, 33, 49, 65, 81, 97, 113,
+	166, 182, 134, 150, 230, 246, 198, 214, 38, 54, 6, 22, 102, 118, 70, 86,
+	187, 171, 155, 139, 251, 235, 219, 203, 59, 43, 27, 11, 123, 107, 91, 75,
+	0, 32, 64, 96, 128, 160, 192, 224, 29, 61, 93, 125, 157, 189, 221, 253,
+	58, 26, 122, 90, 186, 154, 250, 218, 39, 7, 103, 71, 167, 135, 231, 199,
+	116, 84, 52, 20, 244, 212, 180, 148, 105, 73, 41, 9, 233, 201, 169, 137,
+	78, 110, 14, 46, 206, 238, 142, 174, 83, 115, 19, 51, 211, 243, 147, 179,
+	232, 200, 168, 136, 104, 72, 40, 8, 245, 213, 181, 149, 117, 85, 53, 21,
+	210, 242, 146, 178, 82, 114, 18, 50, 207, 239, 143, 175, 79, 111, 15, 47,
+	156, 188, 220, 252, 28, 60, 92, 124, 129, 161, 193, 225, 1, 33, 65, 97,
+	166, 134, 230, 198, 38, 6, 102, 70, 187, 155, 251, 219, 59, 27, 123, 91,
+	205, 237, 141, 173, 77, 109, 13, 45, 208, 240, 144, 176, 80, 112, 16, 48,
+	247, 215, 183, 151, 119, 87, 55, 23, 234, 202, 170, 138, 106, 74, 42, 10,
+	185, 153, 249, 217, 57, 25, 121, 89, 164, 132, 228, 196, 36, 4, 100, 68,
+	131, 163, 195, 227, 3, 35, 67, 99, 158, 190, 222, 254, 30, 62, 94, 126,
+	37, 5, 101, 69, 165, 133, 229, 197, 56, 24, 120, 88, 184, 152, 248, 216,
+	31, 63, 95, 127, 159, 191, 223, 255, 2, 34, 66, 98, 130, 162, 194, 226,
+	81, 113, 17, 49, 209, 241, 145, 177, 76, 108, 12, 44, 204, 236, 140, 172,
+	107, 75, 43, 11, 235, 203, 171, 139, 118, 86, 54, 22, 246, 214, 182, 150,
+	0, 64, 128, 192, 29, 93, 157, 221, 58, 122, 186, 250, 39, 103, 167, 231,
+	116, 52, 244, 180, 105, 41, 233, 169, 78, 14, 206, 142, 83, 19, 211, 147,
+	232, 168, 104, 40, 245, 181, 117, 53, 210, 146, 82, 18, 207, 143, 79, 15,
+	156, 220, 28, 92, 129, 193, 1, 65, 166, 230, 38, 102, 187, 251, 59, 123,
+	205, 141, 77, 13, 208, 144, 80, 16, 247, 183, 119, 55, 234, 170, 106, 42,
+	185, 249, 57, 121, 164, 228, 36, 100, 131, 195, 3, 67, 158, 222, 30, 94,
+	37, 101, 165, 229, 56, 120, 184, 248, 31, 95, 159, 223, 2, 66, 130, 194,
+	81, 17, 209, 145, 76, 12, 204, 140, 107, 43, 235, 171, 118, 54, 246, 182,
+	135, 199, 7, 71, 154, 218, 26, 90, 189, 253, 61, 125, 160, 224, 32, 96,
+	243, 179, 115, 51, 238, 174, 110, 46, 201, 137, 73, 9, 212, 148, 84, 20,
+	111, 47, 239, 175, 114, 50, 242, 178, 85, 21, 213, 149, 72, 8, 200, 136,
+	27, 91, 155, 219, 6, 70, 134, 198, 33, 97, 161, 225, 60, 124, 188, 252,
+	74, 10, 202, 138, 87, 23, 215, 151, 112, 48, 240, 176, 109, 45, 237, 173,
+	62, 126, 190, 254, 35, 99, 163, 227, 4, 68, 132, 196, 25, 89, 153, 217,
+	162, 226, 34, 98, 191, 255, 63, 127, 152, 216, 24, 88, 133, 197, 5, 69,
+	214, 150, 86, 22, 203, 139, 75, 11, 236, 172, 108, 44, 241, 177, 113, 49,
+	0, 128, 29, 157, 58, 186, 39, 167, 116, 244, 105, 233, 78, 206, 83, 211,
+	232, 104, 245, 117, 210, 82, 207, 79, 156, 28, 129, 1, 166, 38, 187, 59,
+	205, 77, 208, 80, 247, 119, 234, 106, 185, 57, 164, 36, 131, 3, 158, 30,
+	37, 165, 56, 184, 31, 159, 2, 130, 81, 209, 76, 204, 107, 235, 118, 246,
+	135, 7, 154, 26, 189, 61, 160, 32, 243, 115, 238, 110, 201, 73, 212, 84,
+	111, 239, 114, 242, 85, 213, 72, 200, 27, 155, 6, 134, 33, 161, 60, 188,
+	74, 202, 87, 215, 112, 240, 109, 237, 62, 190, 35, 163, 4, 132, 25, 153,
+	162, 34, 191, 63, 152, 24, 133, 5, 214, 86, 203, 75, 236, 108, 241, 113,
+	19, 147, 14, 142, 41, 169, 52, 180, 103, 231, 122, 250, 93, 221, 64, 192,
+	251, 123, 230, 102, 193, 65, 220, 92, 143, 15, 146, 18, 181, 53, 168, 40,
+	222, 94, 195, 67, 228, 100, 249, 121, 170, 42, 183, 55, 144, 16, 141, 13,
+	54, 182, 43, 171, 12, 140, 17, 145, 66, 194, 95, 223, 120, 248, 101, 229,
+	148, 20, 137, 9, 174, 46, 179, 51, 224, 96, 253, 125, 218, 90, 199, 71,
+	124, 252, 97, 225, 70, 198, 91, 219, 8, 136, 21, 149, 50, 178, 47, 175,
+	89, 217, 68, 196, 99, 227, 126, 254, 45, 173, 48, 176, 23, 151, 10, 138,
+	177, 49, 172, 44, 139, 11, 150, 22, 197, 69, 216, 88, 255, 127, 226, 98,
+	0, 29, 58, 39, 116, 105, 78, 83, 232, 245, 210, 207, 156, 129, 166, 187,
+	205, 208, 247, 234, 185, 164, 131, 158, 37, 56, 31, 2, 81, 76, 107, 118,
+	135, 154, 189, 160, 243, 238, 201, 212, 111, 114, 85, 72, 27, 6, 33, 60,
+	74, 87, 112, 109, 62, 35, 4, 25, 162, 191, 152, 133, 214, 203, 236, 241,
+	19, 14, 41, 52, 103, 122, 93, 64, 251, 230, 193, 220, 143, 146, 181, 168,
+	222, 195, 228, 249, 170, 183, 144, 141, 54, 43, 12, 17, 66, 95, 120, 101,
+	148, 137, 174, 179, 224, 253, 218, 199, 124, 97, 70, 91, 8, 21, 50, 47,
+	89, 68, 99, 126, 45, 48, 23, 10, 177, 172, 139, 150, 197, 216, 255, 226,
+	38, 59, 28, 1, 82, 79, 104, 117, 206, 211, 244, 233, 186, 167, 128, 157,
+	235, 246, 209, 204, 159, 130, 165, 184, 3, 30, 57, 36, 119, 106, 77, 80,
+	161, 188, 155, 134, 213, 200, 239, 242, 73, 84, 115, 110, 61, 32, 7, 26,
+	108, 113, 86, 75, 24, 5, 34, 63, 132, 153, 190, 163, 240, 237, 202, 215,
+	53, 40, 15, 18, 65, 92, 123, 102, 221, 192, 231, 250, 169, 180, 147, 142,
+	248, 229, 194, 223, 140, 145, 182, 171, 16, 13, 42, 55, 100, 121, 94, 67,
+	178, 175, 136, 149, 198, 219, 252, 225, 90, 71, 96, 125, 46, 51, 20, 9,
+	127, 98, 69, 88, 11, 22, 49, 44, 151, 138, 173, 176, 227, 254, 217, 196,
+	0, 58, 116, 78, 232, 210, 156, 166, 205, 247, 185, 131, 37, 31, 81, 107,
+	135, 189, 243, 201, 111, 85, 27, 33, 74, 112, 62, 4, 162, 152, 214, 236,
+	19, 41, 103, 93, 251, 193, 143, 181, 222, 228, 170, 144, 54, 12, 66, 120,
+	148, 174, 224, 218, 124, 70, 8, 50, 89, 99, 45, 23, 177, 139, 197, 255,
+	38, 28, 82, 104, 206, 244, 186, 128, 235, 209, 159, 165, 3, 57, 119, 77,
+	161, 155, 213, 239, 73, 115, 61, 7, 108, 86, 24, 34, 132, 190, 240, 202,
+	53, 15, 65, 123, 221, 231, 169, 147, 248, 194, 140, 182, 16, 42, 100, 94,
+	178, 136, 198, 252, 90, 96, 46, 20, 127, 69, 11, 49, 151, 173, 227, 217,
+	76, 118, 56, 2, 164, 158, 208, 234, 129, 187, 245, 207, 105, 83, 29, 39,
+	203, 241, 191, 133, 35, 25, 87, 109, 6, 60, 114, 72, 238, 212, 154, 160,
+	95, 101, 43, 17, 183, 141, 195, 249, 146, 168, 230, 220, 122, 64, 14, 52,
+	216, 226, 172, 150, 48, 10, 68, 126, 21, 47, 97, 91, 253, 199, 137, 179,
+	106, 80, 30, 36, 130, 184, 246, 204, 167, 157, 211, 233, 79, 117, 59, 1,
+	237, 215, 153, 163, 5, 63, 113, 75, 32, 26, 84, 110, 200, 242, 188, 134,
+	121, 67, 13, 55, 145, 171, 229, 223, 180, 142, 192, 250, 92, 102, 40, 18,
+	254, 196, 138, 176, 22, 44, 98, 88, 51, 9, 71, 125, 219, 225, 175, 149,
+	0, 116, 232, 156, 205, 185, 37, 81, 135, 243, 111, 27, 74, 62, 162, 214,
+	19, 103, 251, 143, 222, 170, 54, 66, 148, 224, 124, 8, 89, 45, 177, 197,
+	38, 82, 206, 186, 235, 159, 3, 119, 161, 213, 73, 61, 108, 24, 132, 240,
+	53, 65, 221, 169, 248, 140, 16, 100, 178, 198, 90, 46, 127, 11, 151, 227,
+	76, 56, 164, 208, 129, 245, 105, 29, 203, 191, 35, 87, 6, 114, 238, 154,
+	95, 43, 183, 195, 146, 230, 122, 14, 216, 172, 48, 68, 21, 97, 253, 137,
+	106, 30, 130, 246, 167, 211, 79, 59, 237, 153, 5, 113, 32, 84, 200, 188,
+	121, 13, 145, 229, 180, 192, 92, 40, 254, 138, 22, 98, 51, 71, 219, 175,
+	152, 236, 112, 4, 85, 33, 189, 201, 31, 107, 247, 131, 210, 166, 58, 78,
+	139, 255, 99, 23, 70, 50, 174, 218, 12, 120, 228, 144, 193, 181, 41, 93,
+	190, 202, 86, 34, 115, 7, 155, 239, 57, 77, 209, 165, 244, 128, 28, 104,
+	173, 217, 69, 49, 96, 20, 136, 252, 42, 94, 194, 182, 231, 147, 15, 123,
+	212, 160, 60, 72, 25, 109, 241, 133, 83, 39, 187, 207, 158, 234, 118, 2,
+	199, 179, 47, 91, 10, 126, 226, 150, 64, 52, 168, 220, 141, 249, 101, 17,
+	242, 134, 26, 110, 63, 75, 215, 163, 117, 1, 157, 233, 184, 204, 80, 36,
+	225, 149, 9, 125, 44, 88, 196, 176, 102, 18, 142, 250, 171, 223, 67, 55,
+	0, 232, 205, 37, 135, 111, 74, 162, 19, 251, 222, 54, 148, 124, 89, 177,
+	38, 206, 235, 3, 161, 73, 108, 132, 53, 221, 248, 16, 178, 90, 127, 151,
+	76, 164, 129, 105, 203, 35, 6, 238, 95, 183, 146, 122, 216, 48, 21, 253,
+	106, 130, 167, 79, 237, 5, 32, 200, 121, 145, 180, 92, 254, 22, 51, 219,
+	152, 112, 85, 189, 31, 247, 210, 58, 139, 99, 70, 174, 12, 228, 193, 41,
+	190, 86, 115, 155, 57, 209, 244, 28, 173, 69, 96, 136, 42, 194, 231, 15,
+	212, 60, 25, 241, 83, 187, 158, 118, 199, 47, 10, 226, 64, 168, 141, 101,
+	242, 26, 63, 215, 117, 157, 184, 80, 225, 9, 44, 196, 102, 142, 171, 67,
+	45, 197, 224, 8, 170, 66, 103, 143, 62, 214, 243, 27, 185, 81, 116, 156,
+	11, 227, 198, 46, 140, 100, 65, 169, 24, 240, 213, 61, 159, 119, 82, 186,
+	97, 137, 172, 68, 230, 14, 43, 195, 114, 154, 191, 87, 245, 29, 56, 208,
+	71, 175, 138, 98, 192, 40, 13, 229, 84, 188, 153, 113, 211, 59, 30, 246,
+	181, 93, 120, 144, 50, 218, 255, 23, 166, 78, 107, 131, 33, 201, 236, 4,
+	147, 123, 94, 182, 20, 252, 217, 49, 128, 104, 77, 165, 7, 239, 202, 34,
+	249, 17, 52, 220, 126, 150, 179, 91, 234, 2, 39, 207, 109, 133, 160, 72,
+	223, 55, 18, 250, 88, 176, 149, 125, 204, 36, 1, 233, 75, 163, 134, 110,
+	0, 205, 135, 74, 19, 222, 148, 89, 38, 235, 161, 108, 53, 248, 178, 127,
+	76, 129, 203, 6, 95, 146, 216, 21, 106, 167, 237, 32, 121, 180, 254, 51,
+	152, 85, 31, 210, 139, 70, 12, 193, 190, 115, 57, 244, 173, 96, 42, 231,
+	212, 25, 83, 158, 199, 10, 64, 141, 242, 63, 117, 184, 225, 44, 102, 171,
+	45, 224, 170, 103, 62, 243, 185, 116, 11, 198, 140, 65, 24, 213, 159, 82,
+	97, 172, 230, 43, 114, 191, 245, 56, 71, 138, 192, 13, 84, 153, 211, 30,
+	181, 120, 50, 255, 166, 107, 33, 236, 147, 94, 20, 217, 128, 77, 7, 202,
+	249, 52, 126, 179, 234, 39, 109, 160, 223, 18, 88, 149, 204, 1, 75, 134,
+	90, 151, 221, 16, 73, 132, 206, 3, 124, 177, 251, 54, 111, 162, 232, 37,
+	22, 219, 145, 92, 5, 200, 130, 79, 48, 253, 183, 122, 35, 238, 164, 105,
+	194, 15, 69, 136, 209, 28, 86, 155, 228, 41, 99, 174, 247, 58, 112, 189,
+	142, 67, 9, 196, 157, 80, 26, 215, 168, 101, 47, 226, 187, 118, 60, 241,
+	119, 186, 240, 61, 100, 169, 227, 46, 81, 156, 214, 27, 66, 143, 197, 8,
+	59, 246, 188, 113, 40, 229, 175, 98, 29, 208, 154, 87, 14, 195, 137, 68,
+	239, 34, 104, 165, 252, 49, 123, 182, 201, 4, 78, 131, 218, 23, 93, 144,
+	163, 110, 36, 233, 176, 125, 55, 250, 133, 72, 2, 207, 150, 91, 17, 220,
+	0, 135, 19, 148, 38, 161, 53, 178, 76, 203, 95, 216, 106, 237, 121, 254,
+	152, 31, 139, 12, 190, 57, 173, 42, 212, 83, 199, 64, 242, 117, 225, 102,
+	45, 170, 62, 185, 11, 140, 24, 159, 97, 230, 114, 245, 71, 192, 84, 211,
+	181, 50, 166, 33, 147, 20, 128, 7, 249, 126, 234, 109, 223, 88, 204, 75,
+	90, 221, 73, 206, 124, 251, 111, 232, 22, 145, 5, 130, 48, 183, 35, 164,
+	194, 69, 209, 86, 228, 99, 247, 112, 142, 9, 157, 26, 168, 47, 187, 60,
+	119, 240, 100, 227, 81, 214, 66, 197, 59, 188, 40, 175, 29, 154, 14, 137,
+	239, 104, 252, 123, 201, 78, 218, 93, 163, 36, 176, 55, 133, 2, 150, 17,
+	180, 51, 167, 32, 146, 21, 129, 6, 248, 127, 235, 108, 222, 89, 205, 74,
+	44, 171, 63, 184, 10, 141, 25, 158, 96, 231, 115, 244, 70, 193, 85, 210,
+	153, 30, 138, 13, 191, 56, 172, 43, 213, 82, 198, 65, 243, 116, 224, 103,
+	1, 134, 18, 149, 39, 160, 52, 179, 77, 202, 94, 217, 107, 236, 120, 255,
+	238, 105, 253, 122, 200, 79, 219, 92, 162, 37, 177, 54, 132, 3, 151, 16,
+	118, 241, 101, 226, 80, 215, 67, 196, 58, 189, 41, 174, 28, 155, 15, 136,
+	195, 68, 208, 87, 229, 98, 246, 113, 143, 8, 156, 27, 169, 46, 186, 61,
+	91, 220, 72, 207, 125, 250, 110, 233, 23, 144, 4, 131, 49, 182, 34, 165,
+	0, 19, 38, 53, 76, 95, 106, 121, 152, 139, 190, 173, 212, 199, 242, 225,
+	45, 62, 11, 24, 97, 114, 71, 84, 181, 166, 147, 128, 249, 234, 223, 204,
+	90, 73, 124, 111, 22, 5, 48, 35, 194, 209, 228, 247, 142, 157, 168, 187,
+	119, 100, 81, 66, 59, 40, 29, 14, 239, 252, 201, 218, 163, 176, 133, 150,
+	180, 167, 146, 129, 248, 235, 222, 205, 44, 63, 10, 25, 96, 115, 70, 85,
+	153, 138, 191, 172, 213, 198, 243, 224, 1, 18, 39, 52, 77, 94, 107, 120,
+	238, 253, 200, 219, 162, 177, 132, 151, 118, 101, 80, 67, 58, 41, 28, 15,
+	195, 208, 229, 246, 143, 156, 169, 186, 91, 72, 125, 110, 23, 4, 49, 34,
+	117, 102, 83, 64, 57, 42, 31, 12, 237, 254, 203, 216, 161, 178, 135, 148,
+	88, 75, 126, 109, 20, 7, 50, 33, 192, 211, 230, 245, 140, 159, 170, 185,
+	47, 60, 9, 26, 99, 112, 69, 86, 183, 164, 145, 130, 251, 232, 221, 206,
+	2, 17, 36, 55, 78, 93, 104, 123, 154, 137, 188, 175, 214, 197, 240, 227,
+	193, 210, 231, 244, 141, 158, 171, 184, 89, 74, 127, 108, 21, 6, 51, 32,
+	236, 255, 202, 217, 160, 179, 134, 149, 116, 103, 82, 65, 56, 43, 30, 13,
+	155, 136, 189, 174, 215, 196, 241, 226, 3, 16, 37, 54, 79, 92, 105, 122,
+	182, 165, 144, 131, 250, 233, 220, 207, 46, 61, 8, 27, 98, 113, 68, 87,
+	0, 38, 76, 106, 152, 190, 212, 242, 45, 11, 97, 71, 181, 147, 249, 223,
+	90, 124, 22, 48, 194, 228, 142, 168, 119, 81, 59, 29, 239, 201, 163, 133,
+	180, 146, 248, 222, 44, 10, 96, 70, 153, 191, 213, 243, 1, 39, 77, 107,
+	238, 200, 162, 132, 118, 80, 58, 28, 195, 229, 143, 169, 91, 125, 23, 49,
+	117, 83, 57, 31, 237, 203, 161, 135, 88, 126, 20, 50, 192, 230, 140, 170,
+	47, 9, 99, 69, 183, 145, 251, 221, 2, 36, 78, 104, 154, 188, 214, 240,
+	193, 231, 141, 171, 89, 127, 21, 51, 236, 202, 160, 134, 116, 82, 56, 30,
+	155, 189, 215, 241, 3, 37, 79, 105, 182, 144, 250, 220, 46, 8, 98, 68,
+	234, 204, 166, 128, 114, 84, 62, 24, 199, 225, 139, 173, 95, 121, 19, 53,
+	176, 150, 252, 218, 40, 14, 100, 66, 157, 187, 209, 247, 5, 35, 73, 111,
+	94, 120, 18, 52, 198, 224, 138, 172, 115, 85, 63, 25, 235, 205, 167, 129,
+	4, 34, 72, 110, 156, 186, 208, 246, 41, 15, 101, 67, 177, 151, 253, 219,
+	159, 185, 211, 245, 7, 33, 75, 109, 178, 148, 254, 216, 42, 12, 102, 64,
+	197, 227, 137, 175, 93, 123, 17, 55, 232, 206, 164, 130, 112, 86, 60, 26,
+	43, 13, 103, 65, 179, 149, 255, 217, 6, 32, 74, 108, 158, 184, 210, 244,
+	113, 87, 61, 27, 233, 207, 165, 131, 92, 122, 16, 54, 196, 226, 136, 174,
+	0, 76, 152, 212, 45, 97, 181, 249, 90, 22, 194, 142, 119, 59, 239, 163,
+	180, 248, 44, 96, 153, 213, 1, 77, 238, 162, 118, 58, 195, 143, 91, 23,
+	117, 57, 237, 161, 88, 20, 192, 140, 47, 99, 183, 251, 2, 78, 154, 214,
+	193, 141, 89, 21, 236, 160, 116, 56, 155, 215, 3, 79, 182, 250, 46, 98,
+	234, 166, 114, 62, 199, 139, 95, 19, 176, 252, 40, 100, 157, 209, 5, 73,
+	94, 18, 198, 138, 115, 63, 235, 167, 4, 72, 156, 208, 41, 101, 177, 253,
+	159, 211, 7, 75, 178, 254, 42, 102, 197, 137, 93, 17, 232, 164, 112, 60,
+	43, 103, 179, 255, 6, 74, 158, 210, 113, 61, 233, 165, 92, 16, 196, 136,
+	201, 133, 81, 29, 228, 168, 124, 48, 147, 223, 11, 71, 190, 242, 38, 106,
+	125, 49, 229, 169, 80, 28, 200, 132, 39, 107, 191, 243, 10, 70, 146, 222,
+	188, 240, 36, 104, 145, 221, 9, 69, 230, 170, 126, 50, 203, 135, 83, 31,
+	8, 68, 144, 220, 37, 105, 189, 241, 82, 30, 202, 134, 127, 51, 231, 171,
+	35, 111, 187, 247, 14, 66, 150, 218, 121, 53, 225, 173, 84, 24, 204, 128,
+	151, 219, 15, 67, 186, 246, 34, 110, 205, 129, 85, 25, 224, 172, 120, 52,
+	86, 26, 206, 130, 123, 55, 227, 175, 12, 64, 148, 216, 33, 109, 185, 245,
+	226, 174, 122, 54, 207, 131, 87, 27, 184, 244, 32, 108, 149, 217, 13, 65,
+	0, 152, 45, 181, 90, 194, 119, 239, 180, 44, 153, 1, 238, 118, 195, 91,
+	117, 237, 88, 192, 47, 183, 2, 154, 193, 89, 236, 116, 155, 3, 182, 46,
+	234, 114, 199, 95, 176, 40, 157, 5, 94, 198, 115, 235, 4, 156, 41, 177,
+	159, 7, 178, 42, 197, 93, 232, 112, 43, 179, 6, 158, 113, 233, 92, 196,
+	201, 81, 228, 124, 147, 11, 190, 38, 125, 229, 80, 200, 39, 191, 10, 146,
+	188, 36, 145, 9, 230, 126, 203, 83, 8, 144, 37, 189, 82, 202, 127, 231,
+	35, 187, 14, 150, 121, 225, 84, 204, 151, 15, 186, 34, 205, 85, 224, 120,
+	86, 206, 123, 227, 12, 148, 33, 185, 226, 122, 207, 87, 184, 32, 149, 13,
+	143, 23, 162, 58, 213, 77, 248, 96, 59, 163, 22, 142, 97, 249, 76, 212,
+	250, 98, 215, 79, 160, 56, 141, 21, 78, 214, 99, 251, 20, 140, 57, 161,
+	101, 253, 72, 208, 63, 167, 18, 138, 209, 73, 252, 100, 139, 19, 166, 62,
+	16, 136, 61, 165, 74, 210, 103, 255, 164, 60, 137, 17, 254, 102, 211, 75,
+	70, 222, 107, 243, 28, 132, 49, 169, 242, 106, 223, 71, 168, 48, 133, 29,
+	51, 171, 30, 134, 105, 241, 68, 220, 135, 31, 170, 50, 221, 69, 240, 104,
+	172, 52, 129, 25, 246, 110, 219, 67, 24, 128, 53, 173, 66, 218, 111, 247,
+	217, 65, 244, 108, 131, 27, 174, 54, 109, 245, 64, 216, 55, 175, 26, 130,
+	0, 45, 90, 119, 180, 153, 238, 195, 117, 88, 47, 2, 193, 236, 155, 182,
+	234, 199, 176, 157, 94, 115, 4, 41, 159, 178, 197, 232, 43, 6, 113, 92,
+	201, 228, 147, 190, 125, 80, 39, 10, 188, 145, 230, 203, 8, 37, 82, 127,
+	35, 14, 121, 84, 151, 186, 205, 224, 86, 123, 12, 33, 226, 207, 184, 149,
+	143, 162, 213, 248, 59, 22, 97, 76, 250, 215, 160, 141, 78, 99, 20, 57,
+	101, 72, 63, 18, 209, 252, 139, 166, 16, 61, 74, 103, 164, 137, 254, 211,
+	70, 107, 28, 49, 242, 223, 168, 133, 51, 30, 105, 68, 135, 170, 221, 240,
+	172, 129, 246, 219, 24, 53, 66, 111, 217, 244, 131, 174, 109, 64, 55, 26,
+	3, 46, 89, 116, 183, 154, 237, 192, 118, 91, 44, 1, 194, 239, 152, 181,
+	233, 196, 179, 158, 93, 112, 7, 42, 156, 177, 198, 235, 40, 5, 114, 95,
+	202, 231, 144, 189, 126, 83, 36, 9, 191, 146, 229, 200, 11, 38, 81, 124,
+	32, 13, 122, 87, 148, 185, 206, 227, 85, 120, 15, 34, 225, 204, 187, 150,
+	140, 161, 214, 251, 56, 21, 98, 79, 249, 212, 163, 142, 77, 96, 23, 58,
+	102, 75, 60, 17, 210, 255, 136, 165, 19, 62, 73, 100, 167, 138, 253, 208,
+	69, 104, 31, 50, 241, 220, 171, 134, 48, 29, 106, 71, 132, 169, 222, 243,
+	175, 130, 245, 216, 27, 54, 65, 108, 218, 247, 128, 173, 110, 67, 52, 25,
+	0, 90, 180, 238, 117, 47, 193, 155, 234, 176, 94, 4, 159, 197, 43, 113,
+	201, 147, 125, 39, 188, 230, 8, 82, 35, 121, 151, 205, 86, 12, 226, 184,
+	143, 213, 59, 97, 250, 160, 78, 20, 101, 63, 209, 139, 16, 74, 164, 254,
+	70, 28, 242, 168, 51, 105, 135, 221, 172, 246, 24, 66, 217, 131, 109, 55,
+	3, 89, 183, 237, 118, 44, 194, 152, 233, 179, 93, 7, 156, 198, 40, 114,
+	202, 144, 126, 36, 191, 229, 11, 81, 32, 122, 148, 206, 85, 15, 225, 187,
+	140, 214, 56, 98, 249, 163, 77, 23, 102, 60, 210, 136, 19, 73, 167, 253,
+	69, 31, 241, 171, 48, 106, 132, 222, 175, 245, 27, 65, 218, 128, 110, 52,
+	6, 92, 178, 232, 115, 41, 199, 157, 236, 182, 88, 2, 153, 195, 45, 119,
+	207, 149, 123, 33, 186, 224, 14, 84, 37, 127, 145, 203, 80, 10, 228, 190,
+	137, 211, 61, 103, 252, 166, 72, 18, 99, 57, 215, 141, 22, 76, 162, 248,
+	64, 26, 244, 174, 53, 111, 129, 219, 170, 240, 30, 68, 223, 133, 107, 49,
+	5, 95, 177, 235, 112, 42, 196, 158, 239, 181, 91, 1, 154, 192, 46, 116,
+	204, 150, 120, 34, 185, 227, 13, 87, 38, 124, 146, 200, 83, 9, 231, 189,
+	138, 208, 62, 100, 255, 165, 75, 17, 96, 58, 212, 142, 21, 79, 161, 251,
+	67, 25, 247, 173, 54, 108, 130, 216, 169, 243, 29, 71, 220, 134, 104, 50,
+	0, 180, 117, 193, 234, 94, 159, 43, 201, 125, 188, 8, 35, 151, 86, 226,
+	143, 59, 250, 78, 101, 209, 16, 164, 70, 242, 51, 135, 172, 24, 217, 109,
+	3, 183, 118, 194, 233, 93, 156, 40, 202, 126, 191, 11, 32, 148, 85, 225,
+	140, 56, 249, 77, 102, 210, 19, 167, 69, 241, 48, 132, 175, 27, 218, 110,
+	6, 178, 115, 199, 236, 88, 153, 45, 207, 123, 186, 14, 37, 145, 80, 228,
+	137, 61, 252, 72, 99, 215, 22, 162, 64, 244, 53, 129, 170, 30, 223, 107,
+	5, 177, 112, 196, 239, 91, 154, 46, 204, 120, 185, 13, 38, 146, 83, 231,
+	138, 62, 255, 75, 96, 212, 21, 161, 67, 247, 54, 130, 169, 29, 220, 104,
+	12, 184, 121, 205, 230, 82, 147, 39, 197, 113, 176, 4, 47, 155, 90, 238,
+	131, 55, 246, 66, 105, 221, 28, 168, 74, 254, 63, 139, 160, 20, 213, 97,
+	15, 187, 122, 206, 229, 81, 144, 36, 198, 114, 179, 7, 44, 152, 89, 237,
+	128, 52, 245, 65, 106, 222, 31, 171, 73, 253, 60, 136, 163, 23, 214, 98,
+	10, 190, 127, 203, 224, 84, 149, 33, 195, 119, 182, 2, 41, 157, 92, 232,
+	133, 49, 240, 68, 111, 219, 26, 174, 76, 248, 57, 141, 166, 18, 211, 103,
+	9, 189, 124, 200, 227, 87, 150, 34, 192, 116, 181, 1, 42, 158, 95, 235,
+	134, 50, 243, 71, 108, 216, 25, 173, 79, 251, 58, 142, 165, 17, 208, 100,
+	0, 117, 234, 159, 201, 188, 35, 86, 143, 250, 101, 16, 70, 51, 172, 217,
+	3, 118, 233, 156, 202, 191, 32, 85, 140, 249, 102, 19, 69, 48, 175, 218,
+	6, 115, 236, 153, 207, 186, 37, 80, 137, 252, 99, 22, 64, 53, 170, 223,
+	5, 112, 239, 154, 204, 185, 38, 83, 138, 255, 96, 21, 67, 54, 169, 220,
+	12, 121, 230, 147, 197, 176, 47, 90, 131, 246, 105, 28, 74, 63, 160, 213,
+	15, 122, 229, 144, 198, 179, 44, 89, 128, 245, 106, 31, 73, 60, 163, 214,
+	10, 127, 224, 149, 195, 182, 41, 92, 133, 240, 111, 26, 76, 57, 166, 211,
+	9, 124, 227, 150, 192, 181, 42, 95, 134, 243, 108, 25, 79, 58, 165, 208,
+	24, 109, 242, 135, 209, 164, 59, 78, 151, 226, 125, 8, 94, 43, 180, 193,
+	27, 110, 241, 132, 210, 167, 56, 77, 148, 225, 126, 11, 93, 40, 183, 194,
+	30, 107, 244, 129, 215, 162, 61, 72, 145, 228, 123, 14, 88, 45, 178, 199,
+	29, 104, 247, 130, 212, 161, 62, 75, 146, 231, 120, 13, 91, 46, 177, 196,
+	20, 97, 254, 139, 221, 168, 55, 66, 155, 238, 113, 4, 82, 39, 184, 205,
+	23, 98, 253, 136, 222, 171, 52, 65, 152, 237, 114, 7, 81, 36, 187, 206,
+	18, 103, 248, 141, 219, 174, 49, 68, 157, 232, 119, 2, 84, 33, 190, 203,
+	17, 100, 251, 142, 216, 173, 50, 71, 158, 235, 116, 1, 87, 34, 189, 200,
+	0, 234, 201, 35, 143, 101, 70, 172, 3, 233, 202, 32, 140, 102, 69, 175,
+	6, 236, 207, 37, 137, 99, 64, 170, 5, 239, 204, 38, 138, 96, 67, 169,
+	12, 230, 197, 47, 131, 105, 74, 160, 15, 229, 198, 44, 128, 106, 73, 163,
+	10, 224, 195, 41, 133, 111, 76, 166, 9, 227, 192, 42, 134, 108, 79, 165,
+	24, 242, 209, 59, 151, 125, 94, 180, 27, 241, 210, 56, 148, 126, 93, 183,
+	30, 244, 215, 61, 145, 123, 88, 178, 29, 247, 212, 62, 146, 120, 91, 177,
+	20, 254, 221, 55, 155, 113, 82, 184, 23, 253, 222, 52, 152, 114, 81, 187,
+	18, 248, 219, 49, 157, 119, 84, 190, 17, 251, 216, 50, 158, 116, 87, 189,
+	48, 218, 249, 19, 191, 85, 118, 156, 51, 217, 250, 16, 188, 86, 117, 159,
+	54, 220, 255, 21, 185, 83, 112, 154, 53, 223, 252, 22, 186, 80, 115, 153,
+	60, 214, 245, 31, 179, 89, 122, 144, 63, 213, 246, 28, 176, 90, 121, 147,
+	58, 208, 243, 25, 181, 95, 124, 150, 57, 211, 240, 26, 182, 92, 127, 149,
+	40, 194, 225, 11, 167, 77, 110, 132, 43, 193, 226, 8, 164, 78, 109, 135,
+	46, 196, 231, 13, 161, 75, 104, 130, 45, 199, 228, 14, 162, 72, 107, 129,
+	36, 206, 237, 7, 171, 65, 98, 136, 39, 205, 238, 4, 168, 66, 97, 139,
+	34, 200, 235, 1, 173, 71, 100, 142, 33, 203, 232, 2, 174, 68, 103, 141,
+	0, 201, 143, 70, 3, 202, 140, 69, 6, 207, 137, 64, 5, 204, 138, 67,
+	12, 197, 131, 74, 15, 198, 128, 73, 10, 195, 133, 76, 9, 192, 134, 79,
+	24, 209, 151, 94, 27, 210, 148, 93, 30, 215, 145, 88, 29, 212, 146, 91,
+	20, 221, 155, 82, 23, 222, 152, 81, 18, 219, 157, 84, 17, 216, 158, 87,
+	48, 249, 191, 118, 51, 250, 188, 117, 54, 255, 185, 112, 53, 252, 186, 115,
+	60, 245, 179, 122, 63, 246, 176, 121, 58, 243, 181, 124, 57, 240, 182, 127,
+	40, 225, 167, 110, 43, 226, 164, 109, 46, 231, 161, 104, 45, 228, 162, 107,
+	36, 237, 171, 98, 39, 238, 168, 97, 34, 235, 173, 100, 33, 232, 174, 103,
+	96, 169, 239, 38, 99, 170, 236, 37, 102, 175, 233, 32, 101, 172, 234, 35,
+	108, 165, 227, 42, 111, 166, 224, 41, 106, 163, 229, 44, 105, 160, 230, 47,
+	120, 177, 247, 62, 123, 178, 244, 61, 126, 183, 241, 56, 125, 180, 242, 59,
+	116, 189, 251, 50, 119, 190, 248, 49, 114, 187, 253, 52, 113, 184, 254, 55,
+	80, 153, 223, 22, 83, 154, 220, 21, 86, 159, 217, 16, 85, 156, 218, 19,
+	92, 149, 211, 26, 95, 150, 208, 25, 90, 147, 213, 28, 89, 144, 214, 31,
+	72, 129, 199, 14, 75, 130, 196, 13, 78, 135, 193, 8, 77, 132, 194, 11,
+	68, 141, 203, 2, 71, 142, 200, 1, 66, 139, 205, 4, 65, 136, 206, 7,
+	0, 143, 3, 140, 6, 137, 5, 138, 12, 131, 15, 128, 10, 133, 9, 134,
+	24, 151, 27, 148, 30, 145, 29, 146, 20, 155, 23, 152, 18, 157, 17, 158,
+	48, 191, 51, 188, 54, 185, 53, 186, 60, 179, 63, 176, 58, 181, 57, 182,
+	40, 167, 43, 164, 46, 161, 45, 162, 36, 171, 39, 168, 34, 173, 33, 174,
+	96, 239, 99, 236, 102, 233, 101, 234, 108, 227, 111, 224, 106, 229, 105, 230,
+	120, 247, 123, 244, 126, 241, 125, 242, 116, 251, 119, 248, 114, 253, 113, 254,
+	80, 223, 83, 220, 86, 217, 85, 218, 92, 211, 95, 208, 90, 213, 89, 214,
+	72, 199, 75, 196, 78, 193, 77, 194, 68, 203, 71, 200, 66, 205, 65, 206,
+	192, 79, 195, 76, 198, 73, 197, 74, 204, 67, 207, 64, 202, 69, 201, 70,
+	216, 87, 219, 84, 222, 81, 221, 82, 212, 91, 215, 88, 210, 93, 209, 94,
+	240, 127, 243, 124, 246, 121, 245, 122, 252, 115, 255, 112, 250, 117, 249, 118,
+	232, 103, 235, 100, 238, 97, 237, 98, 228, 107, 231, 104, 226, 109, 225, 110,
+	160, 47, 163, 44, 166, 41, 165, 42, 172, 35, 175, 32, 170, 37, 169, 38,
+	184, 55, 187, 52, 190, 49, 189, 50, 180, 59, 183, 56, 178, 61, 177, 62,
+	144, 31, 147, 28, 150, 25, 149, 26, 156, 19, 159, 16, 154, 21, 153, 22,
+	136, 7, 139, 4, 142, 1, 141, 2, 132, 11, 135, 8, 130, 13, 129, 14,
+	0, 3, 6, 5, 12, 15, 10, 9, 24, 27, 30, 29, 20, 23, 18, 17,
+	48, 51, 54, 53, 60, 63, 58, 57, 40, 43, 46, 45, 36, 39, 34, 33,
+	96, 99, 102, 101, 108, 111, 106, 105, 120, 123, 126, 125, 116, 119, 114, 113,
+	80, 83, 86, 85, 92, 95, 90, 89, 72, 75, 78, 77, 68, 71, 66, 65,
+	192, 195, 198, 197, 204, 207, 202, 201, 216, 219, 222, 221, 212, 215, 210, 209,
+	240, 243, 246, 245, 252, 255, 250, 249, 232, 235, 238, 237, 228, 231, 226, 225,
+	160, 163, 166, 165, 172, 175, 170, 169, 184, 187, 190, 189, 180, 183, 178, 177,
+	144, 147, 150, 149, 156, 159, 154, 153, 136, 139, 142, 141, 132, 135, 130, 129,
+	157, 158, 155, 152, 145, 146, 151, 148, 133, 134, 131, 128, 137, 138, 143, 140,
+	173, 174, 171, 168, 161, 162, 167, 164, 181, 182, 179, 176, 185, 186, 191, 188,
+	253, 254, 251, 248, 241, 242, 247, 244, 229, 230, 227, 224, 233, 234, 239, 236,
+	205, 206, 203, 200, 193, 194, 199, 196, 213, 214, 211, 208, 217, 218, 223, 220,
+	93, 94, 91, 88, 81, 82, 87, 84, 69, 70, 67, 64, 73, 74, 79, 76,
+	109, 110, 107, 104, 97, 98, 103, 100, 117, 118, 115, 112, 121, 122, 127, 124,
+	61, 62, 59, 56, 49, 50, 55, 52, 37, 38, 35, 32, 41, 42, 47, 44,
+	13, 14, 11, 8, 1, 2, 7, 4, 21, 22, 19, 16, 25, 26, 31, 28,
+	0, 6, 12, 10, 24, 30, 20, 18, 48, 54, 60, 58, 40, 46, 36, 34,
+	96, 102, 108, 106, 120, 126, 116, 114, 80, 86, 92, 90, 72, 78, 68, 66,
+	192, 198, 204, 202, 216, 222, 212, 210, 240, 246, 252, 250, 232, 238, 228, 226,
+	160, 166, 172, 170, 184, 190, 180, 178, 144, 150, 156, 154, 136, 142, 132, 130,
+	157, 155, 145, 151, 133, 131, 137, 143, 173, 171, 161, 167, 181, 179, 185, 191,
+	253, 251, 241, 247, 229, 227, 233, 239, 205, 203, 193, 199, 213, 211, 217, 223,
+	93, 91, 81, 87, 69, 67, 73, 79, 109, 107, 97, 103, 117, 115, 121, 127,
+	61, 59, 49, 55, 37, 35, 41, 47, 13, 11, 1, 7, 21, 19, 25, 31,
+	39, 33, 43, 45, 63, 57, 51, 53, 23, 17, 27, 29, 15, 9, 3, 5,
+	71, 65, 75, 77, 95, 89, 83, 85, 119, 113, 123, 125, 111, 105, 99, 101,
+	231, 225, 235, 237, 255, 249, 243, 245, 215, 209, 219, 221, 207, 201, 195, 197,
+	135, 129, 139, 141, 159, 153, 147, 149, 183, 177, 187, 189, 175, 169, 163, 165,
+	186, 188, 182, 176, 162, 164, 174, 168, 138, 140, 134, 128, 146, 148, 158, 152,
+	218, 220, 214, 208, 194, 196, 206, 200, 234, 236, 230, 224, 242, 244, 254, 248,
+	122, 124, 118, 112, 98, 100, 110, 104, 74, 76, 70, 64, 82, 84, 94, 88,
+	26, 28, 22, 16, 2, 4, 14, 8, 42, 44, 38, 32, 50, 52, 62, 56,
+	0, 12, 24, 20, 48, 60, 40, 36, 96, 108, 120, 116, 80, 92, 72, 68,
+	192, 204, 216, 212, 240, 252, 232, 228, 160, 172, 184, 180, 144, 156, 136, 132,
+	157, 145, 133, 137, 173, 161, 181, 185, 253, 241, 229, 233, 205, 193, 213, 217,
+	93, 81, 69, 73, 109, 97, 117, 121, 61, 49, 37, 41, 13, 1, 21, 25,
+	39, 43, 63, 51, 23, 27, 15, 3, 71, 75, 95, 83, 119, 123, 111, 99,
+	231, 235, 255, 243, 215, 219, 207, 195, 135, 139, 159, 147, 183, 187, 175, 163,
+	186, 182, 162, 174, 138, 134, 146, 158, 218, 214, 194, 206, 234, 230, 242, 254,
+	122, 118, 98, 110, 74, 70, 82, 94, 26, 22, 2, 14, 42, 38, 50, 62,
+	78, 66, 86, 90, 126, 114, 102, 106, 46, 34, 54, 58, 30, 18, 6, 10,
+	142, 130, 150, 154, 190, 178, 166, 170, 238, 226, 246, 250, 222, 210, 198, 202,
+	211, 223, 203, 199, 227, 239, 251, 247, 179, 191, 171, 167, 131, 143, 155, 151,
+	19, 31, 11, 7, 35, 47, 59, 55, 115, 127, 107, 103, 67, 79, 91, 87,
+	105, 101, 113, 125, 89, 85, 65, 77, 9, 5, 17, 29, 57, 53, 33, 45,
+	169, 165, 177, 189, 153, 149, 129, 141, 201, 197, 209, 221, 249, 245, 225, 237,
+	244, 248, 236, 224, 196, 200, 220, 208, 148, 152, 140, 128, 164, 168, 188, 176,
+	52, 56, 44, 32, 4, 8, 28, 16, 84, 88, 76, 64, 100, 104, 124, 112,
+	0, 24, 48, 40, 96, 120, 80, 72, 192, 216, 240, 232, 160, 184, 144, 136,
+	157, 133, 173, 181, 253, 229, 205, 213, 93, 69, 109, 117, 61, 37, 13, 21,
+	39, 63, 23, 15, 71, 95, 119, 111, 231, 255, 215, 207, 135, 159, 183, 175,
+	186, 162, 138, 146, 218, 194, 234, 242, 122, 98, 74, 82, 26, 2, 42, 50,
+	78, 86, 126, 102, 46, 54, 30, 6, 142, 150, 190, 166, 238, 246, 222, 198,
+	211, 203, 227, 251, 179, 171, 131, 155, 19, 11, 35, 59, 115, 107, 67, 91,
+	105, 113, 89, 65, 9, 17, 57, 33, 169, 177, 153, 129, 201, 209, 249, 225,
+	244, 236, 196, 220, 148, 140, 164, 188, 52, 44, 4, 28, 84, 76, 100, 124,
+	156, 132, 172, 180, 252, 228, 204, 212, 92, 68, 108, 116, 60, 36, 12, 20,
+	1, 25, 49, 41, 97, 121, 81, 73, 193, 217, 241, 233, 161, 185, 145, 137,
+	187, 163, 139, 147, 219, 195, 235, 243, 123, 99, 75, 83, 27, 3, 43, 51,
+	38, 62, 22, 14, 70, 94, 118, 110, 230, 254, 214, 206, 134, 158, 182, 174,
+	210, 202, 226, 250, 178, 170, 130, 154, 18, 10, 34, 58, 114, 106, 66, 90,
+	79, 87, 127, 103, 47, 55, 31, 7, 143, 151, 191, 167, 239, 247, 223, 199,
+	245, 237, 197, 221, 149, 141, 165, 189, 53, 45, 5, 29, 85, 77, 101, 125,
+	104, 112, 88, 64, 8, 16, 56, 32, 168, 176, 152, 128, 200, 208, 248, 224,
+	0, 48, 96, 80, 192, 240, 160, 144, 157, 173, 253, 205, 93, 109, 61, 13,
+	39, 23, 71, 119, 231, 215, 135, 183, 186, 138, 218, 234, 122, 74, 26, 42,
+	78, 126, 46, 30, 142, 190, 238, 222, 211, 227, 179, 131, 19, 35, 115, 67,
+	105, 89, 9, 57, 169, 153, 201, 249, 244, 196, 148, 164, 52, 4, 84, 100,
+	156, 172, 252, 204, 92, 108, 60, 12, 1, 49, 97, 81, 193, 241, 161, 145,
+	187, 139, 219, 235, 123, 75, 27, 43, 38, 22, 70, 118, 230, 214, 134, 182,
+	210, 226, 178, 130, 18, 34, 114, 66, 79, 127, 47, 31, 143, 191, 239, 223,
+	245, 197, 149, 165, 53, 5, 85, 101, 104, 88, 8, 56, 168, 152, 200, 248,
+	37, 21, 69, 117, 229, 213, 133, 181, 184, 136, 216, 232, 120, 72, 24, 40,
+	2, 50, 98, 82, 194, 242, 162, 146, 159, 175, 255, 207, 95, 111, 63, 15,
+	107, 91, 11, 59, 171, 155, 203, 251, 246, 198, 150, 166, 54, 6, 86, 102,
+	76, 124, 44, 28, 140, 188, 236, 220, 209, 225, 177, 129, 17, 33, 113, 65,
+	185, 137, 217, 233, 121, 73, 25, 41, 36, 20, 68, 116, 228, 212, 132, 180,
+	158, 174, 254, 206, 94, 110, 62, 14, 3, 51, 99, 83, 195, 243, 163, 147,
+	247, 199, 151, 167, 55, 7, 87, 103, 106, 90, 10, 58, 170, 154, 202, 250,
+	208, 224, 176, 128, 16, 32, 112, 64, 77, 125, 45, 29, 141, 189, 237, 221,
+	0, 96, 192, 160, 157, 253, 93, 61, 39, 71, 231, 135, 186, 218, 122, 26,
+	78, 46, 142, 238, 211, 179, 19, 115, 105, 9, 169, 201, 244, 148, 52, 84,
+	156, 252, 92, 60, 1, 97, 193, 161, 187, 219, 123, 27, 38, 70, 230, 134,
+	210, 178, 18, 114, 79, 47, 143, 239, 245, 149, 53, 85, 104, 8, 168, 200,
+	37, 69, 229, 133, 184, 216, 120, 24, 2, 98, 194, 162, 159, 255, 95, 63,
+	107, 11, 171, 203, 246, 150, 54, 86, 76, 44, 140, 236, 209, 177, 17, 113,
+	185, 217, 121, 25, 36, 68, 228, 132, 158, 254, 94, 62, 3, 99, 195, 163,
+	247, 151, 55, 87, 106, 10, 170, 202, 208, 176, 16, 112, 77, 45, 141, 237,
+	74, 42, 138, 234, 215, 183, 23, 119, 109, 13, 173, 205, 240, 144, 48, 80,
+	4, 100, 196, 164, 153, 249, 89, 57, 35, 67, 227, 131, 190, 222, 126, 30,
+	214, 182, 22, 118, 75, 43, 139, 235, 241, 145, 49, 81, 108, 12, 172, 204,
+	152, 248, 88, 56, 5, 101, 197, 165, 191, 223, 127, 31, 34, 66, 226, 130,
+	111, 15, 175, 207, 242, 146, 50, 82, 72, 40, 136, 232, 213, 181, 21, 117,
+	33, 65, 225, 129, 188, 220, 124, 28, 6, 102, 198, 166, 155, 251, 91, 59,
+	243, 147, 51, 83, 110, 14, 174, 206, 212, 180, 20, 116, 73, 41, 137, 233,
+	189, 221, 125, 29, 32, 64, 224, 128, 154, 250, 90, 58, 7, 103, 199, 167,
+	0, 192, 157, 93, 39, 231, 186, 122, 78, 142, 211, 19, 105, 169, 244, 52,
+	156, 92, 1, 193, 187, 123, 38, 230, 210, 18, 79, 143, 245, 53, 104, 168,
+	37, 229, 184, 120, 2, 194, 159, 95, 107, 171, 246, 54, 76, 140, 209, 17,
+	185, 121, 36, 228, 158, 94, 3, 195, 247, 55, 106, 170, 208, 16, 77, 141,
+	74, 138, 215, 23, 109, 173, 240, 48, 4, 196, 153, 89, 35, 227, 190, 126,
+	214, 22, 75, 139, 241, 49, 108, 172, 152, 88, 5, 197, 191, 127, 34, 226,
+	111, 175, 242, 50, 72, 136, 213, 21, 33, 225, 188, 124, 6, 198, 155, 91,
+	243, 51, 110, 174, 212, 20, 73, 137, 189, 125, 32, 224, 154, 90, 7, 199,
+	148, 84, 9, 201, 179, 115, 46, 238, 218, 26, 71, 135, 253, 61, 96, 160,
+	8, 200, 149, 85, 47, 239, 178, 114, 70, 134, 219, 27, 97, 161, 252, 60,
+	177, 113, 44, 236, 150, 86, 11, 203, 255, 63, 98, 162, 216, 24, 69, 133,
+	45, 237, 176, 112, 10, 202, 151, 87, 99, 163, 254, 62, 68, 132, 217, 25,
+	222, 30, 67, 131, 249, 57, 100, 164, 144, 80, 13, 205, 183, 119, 42, 234,
+	66, 130, 223, 31, 101, 165, 248, 56, 12, 204, 145, 81, 43, 235, 182, 118,
+	251, 59, 102, 166, 220, 28, 65, 129, 181, 117, 40, 232, 146, 82, 15, 207,
+	103, 167, 250, 58, 64, 128, 221, 29, 41, 233, 180, 116, 14, 206, 147, 83,
+};
+
+// GF 285, first root 0, (15, 13)
+
+static const uint8_t rs2_fixed_285_0_15_13_genpoly[3] = {
+	2, 3, 1, 
+};
+
+static const uint8_t rs2_fixed_285_0_15_13_encode[512] = {
+	0, 0, 3, 2, 6, 4, 5, 6, 12, 8, 15, 10, 10, 12, 9, 14,
+	24, 16, 27, 18, 30, 20, 29, 22, 20, 24, 23, 26, 18, 28, 17, 30,
+	48, 32, 51, 34, 54, 36, 53, 38, 60, 40, 63, 42, 58, 44, 57, 46,
+	40, 48, 43, 50, 46, 52, 45, 54, 36, 56, 39, 58, 34, 60, 33, 62,
+	96, 64, 99, 66, 102, 68, 101, 70, 108, 72, 111, 74, 106, 76, 105, 78,
+	120, 80, 123, 82, 126, 84, 125, 86, 116, 88, 119, 90, 114, 92, 113, 94,
+	80, 96, 83, 98, 86, 100, 85, 102, 92, 104, 95, 106, 90, 108, 89, 110,
+	72, 112, 75, 114, 78, 116, 77, 118, 68, 120, 71, 122, 66, 124, 65, 126,
+	192, 128, 195, 130, 198, 132, 197, 134, 204, 136, 207, 138, 202, 140, 201, 142,
+	216, 144, 219, 146, 222, 148, 221, 150, 212, 152, 215, 154, 210, 156, 209, 158,
+	240, 160, 243, 162, 246, 164, 245, 166, 252, 168, 255, 170, 250, 172, 249, 174,
+	232, 176, 235, 178, 238, 180, 237, 182, 228, 184, 231, 186, 226, 188, 225, 190,
+	160, 192, 163, 194, 166, 196, 165, 198, 172, 200, 175, 202, 170, 204, 169, 206,
+	184, 208, 187, 210, 190, 212, 189, 214, 180, 216, 183, 218, 178, 220, 177, 222,
+	144, 224, 147, 226, 150, 228, 149, 230, 156, 232, 159, 234, 154, 236, 153, 238,
+	136, 240, 139, 242, 142, 244, 141, 246, 132, 248, 135, 250, 130, 252, 129, 254,
+	157, 29, 158, 31, 155, 25, 152, 27, 145, 21, 146, 23, 151, 17, 148, 19,
+	133, 13, 134, 15, 131, 9, 128, 11, 137, 5, 138, 7, 143, 1, 140, 3,
+	173, 61, 174, 63, 171, 57, 168, 59, 161, 53, 162, 55, 167, 49, 164, 51,
+	181, 45, 182, 47, 179, 41, 176, 43, 185, 37, 186, 39, 191, 33, 188, 35,
+	253, 93, 254, 95, 251, 89, 248, 91, 241, 85, 242, 87, 247, 81, 244, 83,
+	229, 77, 230, 79, 227, 73, 224, 75, 233, 69, 234, 71, 239, 65, 236, 67,
+	205, 125, 206, 127, 203, 121, 200, 123, 193, 117, 194, 119, 199, 113, 196, 115,
+	213, 109, 214, 111, 211, 105, 208, 107, 217, 101, 218, 103, 223, 97, 220, 99,
+	93, 157, 94, 159, 91, 153, 88, 155, 81, 149, 82, 151, 87, 145, 84, 147,
+	69, 141, 70, 143, 67, 137, 64, 139, 73, 133, 74, 135, 79, 129, 76, 131,
+	109, 189, 110, 191, 107, 185, 104, 187, 97, 181, 98, 183, 103, 177, 100, 179,
+	117, 173, 118, 175, 115, 169, 112, 171, 121, 165, 122, 167, 127, 161, 124, 163,
+	61, 221, 62, 223, 59, 217, 56, 219, 49, 213, 50, 215, 55, 209, 52, 211,
+	37, 205, 38, 207, 35, 201, 32, 203, 41, 197, 42, 199, 47, 193, 44, 195,
+	13, 253, 14, 255, 11, 249, 8, 251, 1, 245, 2, 247, 7, 241, 4, 243,
+	21, 237, 22, 239, 19, 233, 16, 235, 25, 229, 26, 231, 31, 225, 28, 227,
+};
+
+static const uint8_t rs2_fixed_285_0_15_13_mulroot[512] = {
+	0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+	16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+	32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+	48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+	64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+	80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,
+	96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+	112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127,
+	128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143,
+	144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159,
+	160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175,
+	176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191,
+	192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207,
+	208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223,
+	224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239,
+	240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255,
+	0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30,
+	32, 34, 36, 38, 40, 42, 44, 46, 48, 50, 52, 54, 56, 58, 60, 62,
+	64, 66, 68, 70, 72, 74, 76, 78, 80, 82, 84, 86, 88, 90, 92, 94,
+	96, 98, 100, 102, 104, 106, 108, 110, 112, 114, 116, 118, 120, 122, 124, 126,
+	128, 130, 132, 134, 136, 138, 140, 142, 144, 146, 148, 150, 152, 154, 156, 158,
+	160, 162, 164, 166, 168, 170, 172, 174, 176, 178, 180, 182, 184, 186, 188, 190,
+	192, 194, 196, 198, 200, 202, 204, 206, 208, 210, 212, 214, 216, 218, 220, 222,
+	224, 226, 228, 230, 232, 234, 236, 238, 240, 242, 244, 246, 248, 250, 252, 254,
+	29, 31, 25, 27, 21, 23, 17, 19, 13, 15, 9, 11, 5, 7, 1, 3,
+	61, 63, 57, 59, 53, 55, 49, 51, 45, 47, 41, 43, 37, 39, 33, 35,
+	93, 95, 89, 91, 85, 87, 81, 83, 77, 79, 73, 75, 69, 71, 65, 67,
+	125, 127, 121, 123, 117, 119, 113, 115, 109, 111, 105, 107, 101, 103, 97, 99,
+	157, 159, 153, 155, 149, 151, 145, 147, 141, 143, 137, 139, 133, 135, 129, 131,
+	189, 191, 185, 187, 181, 183, 177, 179, 173, 175, 169, 171, 165, 167, 161, 163,
+	221, 223, 217, 219, 213, 215, 209, 211, 205, 207, 201, 203, 197, 199, 193, 195,
+	253, 255, 249, 251, 245, 247, 241, 243, 237, 239, 233, 235, 229, 231, 225, 227,
+};
+
+#endif	/* RS2_FIXED_TABLES_H */
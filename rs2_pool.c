@@ -0,0 +1,95 @@
+#include <stdlib.h>
+#include "rs2_pool.h"
+
+void run_jobs(RS2_pool_struct *pool) {
+	// Take and run jobs until none are left. Called with the lock held;
+	// returns with it held.
+	while (pool->NextJob < pool->JobCount) {
+		int job = pool->NextJob++;
+		pthread_mutex_unlock(&pool->Lock);
+		pool->Job(pool->Arg, job);
+		pthread_mutex_lock(&pool->Lock);
+		pool->Pending--;
+		if (pool->Pending == 0) {
+			pthread_cond_signal(&pool->Done);
+		}
+	}
+}
+
+void *pool_thread(void *arg) {
+	RS2_pool_struct *pool = arg;
+	pthread_mutex_lock(&pool->Lock);
+	for (;;) {
+		while (!pool->Stop && (pool->NextJob >= pool->JobCount)) {
+			pthread_cond_wait(&pool->Start, &pool->Lock);
+		}
+		if (pool->Stop) {
+			break;
+		}
+		run_jobs(pool);
+	}
+	pthread_mutex_unlock(&pool->Lock);
+	return NULL;
+}
+
+int InitRS2Pool(int threads, RS2_pool_struct *pool) {
+	pool->ThreadCount = 1;
+	pool->Job = NULL;
+	pool->Arg = NULL;
+	pool->JobCount = 0;
+	pool->NextJob = 0;
+	pool->Pending = 0;
+	pool->Stop = 0;
+	pool->Threads = NULL;
+	pthread_mutex_init(&pool->Lock, NULL);
+	pthread_cond_init(&pool->Start, NULL);
+	pthread_cond_init(&pool->Done, NULL);
+	if (threads > 1) {
+		pool->Threads = malloc(sizeof(pthread_t) * (threads - 1));
+		if (pool->Threads == NULL) {
+			FreeRS2Pool(pool);
+			return -1;
+		}
+		for (int i = 0; i < threads - 1; i++) {
+			if (pthread_create(&pool->Threads[i], NULL, pool_thread, pool) != 0) {
+				FreeRS2Pool(pool);
+				return -1;
+			}
+			pool->ThreadCount++;
+		}
+	}
+	return 0;
+}
+
+void FreeRS2Pool(RS2_pool_struct *pool) {
+	pthread_mutex_lock(&pool->Lock);
+	pool->Stop = 1;
+	pthread_cond_broadcast(&pool->Start);
+	pthread_mutex_unlock(&pool->Lock);
+	for (int i = 0; i < pool->ThreadCount - 1; i++) {
+		pthread_join(pool->Threads[i], NULL);
+	}
+	free(pool->Threads);
+	pool->Threads = NULL;
+	pool->ThreadCount = 1;
+	pthread_mutex_destroy(&pool->Lock);
+	pthread_cond_destroy(&pool->Start);
+	pthread_cond_destroy(&pool->Done);
+}
+
+void RS2PoolRun(RS2_pool_struct *pool, void (*job)(void *, int), void *arg, int count) {
+	pthread_mutex_lock(&pool->Lock);
+	pool->Job = job;
+	pool->Arg = arg;
+	pool->JobCount = count;
+	pool->NextJob = 0;
+	pool->Pending = count;
+	if (pool->ThreadCount > 1) {
+		pthread_cond_broadcast(&pool->Start);
+	}
+	run_jobs(pool);
+	while (pool->Pending > 0) {
+		pthread_cond_wait(&pool->Done, &pool->Lock);
+	}
+	pthread_mutex_unlock(&pool->Lock);
+}
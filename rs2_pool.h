@@ -0,0 +1,48 @@
+/*
+ * File:   rs2_pool.h
+ *
+ * Created on October 17, 2026
+ */
+
+#ifndef RS2_POOL_H
+#define	RS2_POOL_H
+
+#include <pthread.h>
+
+// Persistent worker threads for splitting one decode across cores. The
+// threads sleep on a condition variable between calls, so a call costs a
+// wakeup rather than a thread creation.
+typedef struct RS2_pool_struct {
+	pthread_t *Threads; // helper threads; the calling thread also works
+	int ThreadCount; // helpers plus the caller
+	pthread_mutex_t Lock;
+	pthread_cond_t Start;
+	pthread_cond_t Done;
+	void (*Job)(void *, int);
+	void *Arg;
+	int JobCount;
+	int NextJob;
+	int Pending; // jobs taken or not, still unfinished
+	int Stop;
+} RS2_pool_struct;
+
+// InitRS2Pool
+// Starts a pool of threads. Call FreeRS2Pool to stop them.
+// Arg1: total thread count, including the thread that calls RS2PoolRun
+// Returns 0 on success, -1 if the threads could not be created.
+int InitRS2Pool(int, RS2_pool_struct*);
+
+// FreeRS2Pool
+// Stops and joins the pool threads.
+void FreeRS2Pool(RS2_pool_struct*);
+
+// RS2PoolRun
+// Calls job(arg, i) for i from 0 to count - 1, spread over the pool threads
+// and the caller, and returns when all calls have finished. One caller at a
+// time per pool.
+// Arg2: job function
+// Arg3: argument passed to each call
+// Arg4: number of calls
+void RS2PoolRun(RS2_pool_struct*, void (*)(void *, int), void *, int);
+
+#endif	/* RS2_POOL_H */
@@ -0,0 +1,216 @@
+#include <stdlib.h>
+#include <string.h>
+#include "rs2_shard.h"
+#include "rs2.h"
+#include "gf2.h"
+#include "gf2_region.h"
+
+int InitRS2Shards(int data_shards, const RS2_def_struct *rs, RS2_shard_struct *sh) {
+	int k = data_shards;
+	int m = rs->NumRoots;
+	sh->RS = rs;
+	sh->DataShards = k;
+	sh->ParityShards = m;
+	sh->Parity = NULL;
+	if ((rs->GF->Power > 8) || (k < 1) || (k + m > rs->FieldOrder - 1)) {
+		return -1;
+	}
+	sh->Parity = malloc(sizeof(uint8_t) * m * k);
+	if (sh->Parity == NULL) {
+		return -1;
+	}
+	// The code is linear, so the parity of a unit message is one column of
+	// the encoding matrix.
+	uint8_t message[RS2_MAX_BLOCK8];
+	for (int j = 0; j < k; j++) {
+		memset(message, 0, k + m);
+		message[j] = 1;
+		RSEncode8(message, k, rs);
+		for (int p = 0; p < m; p++) {
+			sh->Parity[(p * k) + j] = message[k + p];
+		}
+	}
+	return 0;
+}
+
+void FreeRS2Shards(RS2_shard_struct *sh) {
+	free(sh->Parity);
+	sh->Parity = NULL;
+}
+
+int InitRS2ShardWork(const RS2_shard_struct *sh, RS2_shard_work_struct *sw) {
+	int k = sh->DataShards;
+	int m = sh->ParityShards;
+	// One allocation for the rows of every cache entry, owned by entry 0.
+	uint8_t *rows = malloc(sizeof(uint8_t) * RS2_SHARD_CACHE_SIZE * m * k);
+	for (int i = 0; i < RS2_SHARD_CACHE_SIZE; i++) {
+		sw->Cache[i].Rows = rows ? &rows[i * m * k] : NULL;
+		sw->Cache[i].Used = 0;
+	}
+	sw->NextEntry = 0;
+	sw->Matrix = malloc(sizeof(uint8_t) * k * 2 * k);
+	sw->Survivors = malloc(sizeof(int) * k);
+	sw->Missing = malloc(sizeof(int) * (k + m));
+	sw->Sources = malloc(sizeof(uint8_t *) * k);
+	sw->CacheHits = 0;
+	sw->CacheMisses = 0;
+	if ((rows == NULL) || (sw->Matrix == NULL) || (sw->Survivors == NULL) || (sw->Missing == NULL) || (sw->Sources == NULL)) {
+		FreeRS2ShardWork(sw);
+		return -1;
+	}
+	return 0;
+}
+
+void FreeRS2ShardWork(RS2_shard_work_struct *sw) {
+	free(sw->Cache[0].Rows);
+	for (int i = 0; i < RS2_SHARD_CACHE_SIZE; i++) {
+		sw->Cache[i].Rows = NULL;
+		sw->Cache[i].Used = 0;
+	}
+	free(sw->Matrix);
+	free(sw->Survivors);
+	free(sw->Missing);
+	free(sw->Sources);
+	sw->Matrix = NULL;
+	sw->Survivors = NULL;
+	sw->Missing = NULL;
+	sw->Sources = NULL;
+}
+
+void combine_shards(uint8_t **outputs, int output_count, const uint8_t *const *sources, int source_count, const uint8_t *rows, int size, GF2_def_struct *gf) {
+	// outputs[o] = sum over j of rows[o * source_count + j] * sources[j], a
+	// tile at a time, so the source tiles are reused from cache by every
+	// output.
+	for (int offset = 0; offset < size; offset += RS2_SHARD_TILE) {
+		int length = (size - offset < RS2_SHARD_TILE) ? size - offset : RS2_SHARD_TILE;
+		for (int o = 0; o < output_count; o++) {
+			const uint8_t *row = &rows[o * source_count];
+			GF2MulRegion(&outputs[o][offset], &sources[0][offset], row[0], length, gf);
+			for (int j = 1; j < source_count; j++) {
+				GF2MulAddRegion(&outputs[o][offset], &sources[j][offset], row[j], length, gf);
+			}
+		}
+	}
+}
+
+void RSEncodeShards(uint8_t **shards, int size, const RS2_shard_struct *sh) {
+	int k = sh->DataShards;
+	combine_shards(&shards[k], sh->ParityShards, (const uint8_t *const *)shards, k, sh->Parity, size, sh->RS->GF);
+}
+
+int invert_matrix(uint8_t *matrix, int n, GF2_def_struct *gf) {
+	// Gauss-Jordan on n rows of [A | I], leaving [I | A^-1].
+	// Returns -1 if A is singular.
+	int width = 2 * n;
+	for (int c = 0; c < n; c++) {
+		int pivot = c;
+		while ((pivot < n) && (matrix[(pivot * width) + c] == 0)) {
+			pivot++;
+		}
+		if (pivot == n) {
+			return -1;
+		}
+		if (pivot != c) {
+			for (int j = 0; j < width; j++) {
+				uint8_t t = matrix[(pivot * width) + j];
+				matrix[(pivot * width) + j] = matrix[(c * width) + j];
+				matrix[(c * width) + j] = t;
+			}
+		}
+		uint8_t *row = &matrix[c * width];
+		int scale = GF2Inv(row[c], gf);
+		if (scale != 1) {
+			GF2MulRegion(row, row, scale, width, gf);
+		}
+		for (int r = 0; r < n; r++) {
+			uint8_t *other = &matrix[r * width];
+			if ((r != c) && other[c]) {
+				GF2MulAddRegion(other, row, other[c], width, gf);
+			}
+		}
+	}
+	return 0;
+}
+
+const uint8_t *decode_rows(int missing_data, const RS2_shard_struct *sh, RS2_shard_work_struct *sw) {
+	// Rows of the inverse of the survivors' encoding rows that give the
+	// missing data shards, from the cache or built and cached.
+	int k = sh->DataShards;
+	uint64_t key[4] = {0, 0, 0, 0};
+	for (int j = 0; j < k; j++) {
+		key[sw->Survivors[j] >> 6] |= (uint64_t)1 << (sw->Survivors[j] & 63);
+	}
+	for (int i = 0; i < RS2_SHARD_CACHE_SIZE; i++) {
+		RS2_shard_cache_struct *entry = &sw->Cache[i];
+		if (entry->Used && (memcmp(entry->Key, key, sizeof(key)) == 0)) {
+			sw->CacheHits++;
+			return entry->Rows;
+		}
+	}
+	sw->CacheMisses++;
+	int width = 2 * k;
+	for (int r = 0; r < k; r++) {
+		uint8_t *row = &sw->Matrix[r * width];
+		int s = sw->Survivors[r];
+		memset(row, 0, width);
+		if (s < k) {
+			row[s] = 1;
+		} else {
+			memcpy(row, &sh->Parity[(s - k) * k], k);
+		}
+		row[k + r] = 1;
+	}
+	if (invert_matrix(sw->Matrix, k, sh->RS->GF) < 0) {
+		return NULL;
+	}
+	RS2_shard_cache_struct *entry = &sw->Cache[sw->NextEntry];
+	sw->NextEntry = (sw->NextEntry + 1) % RS2_SHARD_CACHE_SIZE;
+	for (int i = 0; i < missing_data; i++) {
+		memcpy(&entry->Rows[i * k], &sw->Matrix[(sw->Missing[i] * width) + k], k);
+	}
+	memcpy(entry->Key, key, sizeof(key));
+	entry->Used = 1;
+	return entry->Rows;
+}
+
+int RSRebuildShards(uint8_t **shards, const int *present, int size, const RS2_shard_struct *sh, RS2_shard_work_struct *sw) {
+	int k = sh->DataShards;
+	int m = sh->ParityShards;
+	int missing = 0;
+	int missing_data = 0;
+	int survivors = 0;
+	for (int i = 0; i < k + m; i++) {
+		if (!present[i]) {
+			sw->Missing[missing++] = i;
+			if (i < k) {
+				missing_data++;
+			}
+		} else if (survivors < k) {
+			// Intact data shards come first, so they are always among the
+			// survivors, and a missing data shard never is.
+			sw->Survivors[survivors] = i;
+			sw->Sources[survivors] = shards[i];
+			survivors++;
+		}
+	}
+	if (missing > m) {
+		return -1;
+	}
+	if (missing_data > 0) {
+		const uint8_t *rows = decode_rows(missing_data, sh, sw);
+		if (rows == NULL) {
+			return -1;
+		}
+		uint8_t *outputs[RS2_MAX_BLOCK8];
+		for (int i = 0; i < missing_data; i++) {
+			outputs[i] = shards[sw->Missing[i]];
+		}
+		combine_shards(outputs, missing_data, sw->Sources, k, rows, size, sh->RS->GF);
+	}
+	// With the data whole, lost parity is encoded again, row by row.
+	for (int i = missing_data; i < missing; i++) {
+		int p = sw->Missing[i] - k;
+		combine_shards(&shards[k + p], 1, (const uint8_t *const *)shards, k, &sh->Parity[p * k], size, sh->RS->GF);
+	}
+	return missing;
+}
@@ -0,0 +1,57 @@
+/*
+ * File:   rs2_shard.h
+ *
+ * Created on October 17, 2026
+ */
+
+#ifndef RS2_SHARD_H
+#define	RS2_SHARD_H
+
+#include "rs2_def_struct.h"
+
+// Shard erasure code over byte buffers. Byte x of data shards 0..k-1 and
+// parity shards k..k+m-1 form one codeword of the code, in shard order, so
+// any m lost shards of equal size can be rebuilt from the k left. Fields of
+// 8 bits or less only.
+
+// InitRS2Shards
+// Sets up a shard code on an initialized Reed Solomon code, whose NumRoots
+// is the number of parity shards. The code must outlive the shard code.
+// Arg1: number of data shards, k
+// Arg2: initialized Reed Solomon code
+// Returns 0 on success, -1 if the field is over 8 bits, k + NumRoots
+// exceeds the largest block, or memory could not be allocated.
+int InitRS2Shards(int, const RS2_def_struct*, RS2_shard_struct*);
+
+// FreeRS2Shards
+// Releases memory allocated by InitRS2Shards.
+void FreeRS2Shards(RS2_shard_struct*);
+
+// InitRS2ShardWork
+// Allocates rebuild scratch and the decode matrix cache for a shard code.
+// Each thread rebuilding with the same shard code needs its own.
+// Returns 0 on success, -1 if memory could not be allocated.
+int InitRS2ShardWork(const RS2_shard_struct*, RS2_shard_work_struct*);
+
+// FreeRS2ShardWork
+// Releases memory allocated by InitRS2ShardWork.
+void FreeRS2ShardWork(RS2_shard_work_struct*);
+
+// RSEncodeShards
+// Computes the parity shards from the data shards.
+// Arg1: array of k + m shard buffers, data first; parity buffers are written
+// Arg2: bytes per shard
+void RSEncodeShards(uint8_t **, int, const RS2_shard_struct*);
+
+// RSRebuildShards
+// Rebuilds missing shards in place from the survivors. Missing data shards
+// are decoded from the first k survivors with the inverse of their rows of
+// the encoding matrix, cached per erasure pattern; missing parity shards
+// are then encoded again.
+// Arg1: array of k + m shard buffers; missing ones are overwritten
+// Arg2: array of k + m flags, nonzero where the shard is intact
+// Arg3: bytes per shard
+// Returns number of shards rebuilt, or -1 if more than m are missing.
+int RSRebuildShards(uint8_t **, const int *, int, const RS2_shard_struct*, RS2_shard_work_struct*);
+
+#endif	/* RS2_SHARD_H */
@@ -0,0 +1,49 @@
+/*
+ * File:   rs2_stages.h
+ *
+ * Created on October 17, 2026
+ */
+
+#ifndef RS2_STAGES_H
+#define	RS2_STAGES_H
+
+#include "rs2_def_struct.h"
+
+// The decoder stages behind RSDecodeErasures8/16, for benchmarks and tools
+// that drive them one at a time. Each reads and writes the workspace as
+// RSDecodeErasures8 does; call set_erasures first to start a decode.
+
+// set_erasures
+// Records the block size and erasure list in the workspace.
+// Returns 0, or -1 if the erasure list is invalid.
+int set_erasures(int, const int *, int, const RS2_def_struct*, RS2_work_struct*);
+
+// calc_syndromes8, calc_syndromes16
+// Computes ws->Syndromes from a block.
+// Returns the number of nonzero syndromes.
+int calc_syndromes8(const RS2_def_struct*, RS2_work_struct*, const uint8_t *);
+int calc_syndromes16(const RS2_def_struct*, RS2_work_struct*, const uint16_t *);
+
+// calc_berlekamp2
+// Computes the error locator and evaluator polynomials from ws->Syndromes.
+void calc_berlekamp2(const RS2_def_struct*, RS2_work_struct*);
+
+// calc_chien
+// Finds the error locations from the roots of the locator polynomial.
+// Returns the number of roots found.
+int calc_chien(const RS2_def_struct*, RS2_work_struct*);
+
+// calc_forney
+// Computes the error magnitudes at the locations found by calc_chien.
+void calc_forney(const RS2_def_struct*, RS2_work_struct*);
+
+// save_syndromes
+// Copies ws->Syndromes to ws->SavedSyndromes.
+void save_syndromes(const RS2_def_struct*, RS2_work_struct*);
+
+// update_syndromes
+// Adds the contribution of each correction to ws->Syndromes.
+// Returns the number of syndromes still nonzero.
+int update_syndromes(const RS2_def_struct*, RS2_work_struct*);
+
+#endif	/* RS2_STAGES_H */
@@ -0,0 +1,145 @@
+#include <string.h>
+#include <time.h>
+#include "rs2_stats.h"
+
+#if defined(RS2_STATS) && defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define RS2_STATS_TSC 1
+#include <x86intrin.h>
+#endif
+
+#ifdef RS2_STATS
+static const char *stage_names[RS2_STAGE_COUNT] = {
+	"syndromes", "berlekamp", "chien", "forney", "verify", "batch syndromes"
+};
+
+uint64_t RS2StatsClock(void) {
+#ifdef RS2_STATS_TSC
+	return __rdtsc();
+#else
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return ((uint64_t)now.tv_sec * 1000000000u) + (uint64_t)now.tv_nsec;
+#endif
+}
+
+void rs2_stats_stage(RS2_stats_struct *stats, int stage, uint64_t start) {
+	stats->StageTime[stage] += RS2StatsClock() - start;
+	stats->StageCalls[stage]++;
+}
+
+void rs2_stats_decode(RS2_stats_struct *stats, int result, uint64_t start) {
+	// Latency goes in the row for the symbols corrected, or the failed row,
+	// and in the bucket for its highest set bit.
+	uint64_t elapsed = RS2StatsClock() - start;
+	int row = (result < 0) ? RS2_STATS_ROWS : ((result < RS2_STATS_ROWS) ? result : RS2_STATS_ROWS - 1);
+	int bucket = 0;
+	while ((bucket < RS2_STATS_BUCKETS - 1) && ((elapsed >> (bucket + 1)) != 0)) {
+		bucket++;
+	}
+	stats->Decodes++;
+	if (result < 0) {
+		stats->Failed++;
+	}
+	stats->LatencyTime[row] += elapsed;
+	stats->Latency[row][bucket]++;
+}
+
+// Upper bound of the bucket holding the given fraction of a row's decodes.
+uint64_t latency_percentile(const uint64_t *buckets, uint64_t count, double fraction) {
+	uint64_t target = (uint64_t)(fraction * count);
+	uint64_t seen = 0;
+	for (int b = 0; b < RS2_STATS_BUCKETS; b++) {
+		seen += buckets[b];
+		if (seen > target) {
+			return (uint64_t)1 << (b + 1);
+		}
+	}
+	return (uint64_t)1 << RS2_STATS_BUCKETS;
+}
+#endif
+
+int RS2StatsEnabled(void) {
+#ifdef RS2_STATS
+	return 1;
+#else
+	return 0;
+#endif
+}
+
+const char *RS2StatsUnit(void) {
+#ifdef RS2_STATS_TSC
+	return "cycles";
+#else
+	return "ns";
+#endif
+}
+
+void RS2StatsReset(RS2_work_struct *ws) {
+#ifdef RS2_STATS
+	memset(&ws->Stats, 0, sizeof(ws->Stats));
+#else
+	(void)ws;
+#endif
+}
+
+void RS2StatsMerge(RS2_work_struct *to, const RS2_work_struct *from) {
+#ifdef RS2_STATS
+	for (int i = 0; i < RS2_STAGE_COUNT; i++) {
+		to->Stats.StageTime[i] += from->Stats.StageTime[i];
+		to->Stats.StageCalls[i] += from->Stats.StageCalls[i];
+	}
+	to->Stats.Decodes += from->Stats.Decodes;
+	to->Stats.FastPath += from->Stats.FastPath;
+	to->Stats.Failed += from->Stats.Failed;
+	for (int r = 0; r <= RS2_STATS_ROWS; r++) {
+		to->Stats.LatencyTime[r] += from->Stats.LatencyTime[r];
+		for (int b = 0; b < RS2_STATS_BUCKETS; b++) {
+			to->Stats.Latency[r][b] += from->Stats.Latency[r][b];
+		}
+	}
+#else
+	(void)to;
+	(void)from;
+#endif
+}
+
+void RS2StatsDump(FILE *out, const RS2_work_struct *ws) {
+#ifdef RS2_STATS
+	const RS2_stats_struct *stats = &ws->Stats;
+	const char *unit = RS2StatsUnit();
+	fprintf(out, "\r\nDecoder Stage Timing (%s):", unit);
+	fprintf(out, "\r\nstage, calls, total, average");
+	for (int i = 0; i < RS2_STAGE_COUNT; i++) {
+		uint64_t calls = stats->StageCalls[i];
+		fprintf(out, "\r\n%s, %llu, %llu, %.1f", stage_names[i], (unsigned long long)calls,
+			(unsigned long long)stats->StageTime[i], calls ? (double)stats->StageTime[i] / calls : 0.0);
+	}
+	fprintf(out, "\r\nDecodes: %llu, fast path: %llu, failed: %llu", (unsigned long long)stats->Decodes,
+		(unsigned long long)stats->FastPath, (unsigned long long)stats->Failed);
+	fprintf(out, "\r\nDecode Latency by Symbols Corrected (%s, percentiles are bucket upper bounds):", unit);
+	fprintf(out, "\r\ncorrected, decodes, average, p50, p99");
+	for (int r = 0; r <= RS2_STATS_ROWS; r++) {
+		uint64_t count = 0;
+		for (int b = 0; b < RS2_STATS_BUCKETS; b++) {
+			count += stats->Latency[r][b];
+		}
+		if (count == 0) {
+			continue;
+		}
+		if (r == RS2_STATS_ROWS) {
+			fprintf(out, "\r\nfailed");
+		} else if (r == RS2_STATS_ROWS - 1) {
+			fprintf(out, "\r\n%i+", r);
+		} else {
+			fprintf(out, "\r\n%i", r);
+		}
+		fprintf(out, ", %llu, %.1f, %llu, %llu", (unsigned long long)count, (double)stats->LatencyTime[r] / count,
+			(unsigned long long)latency_percentile(stats->Latency[r], count, 0.5),
+			(unsigned long long)latency_percentile(stats->Latency[r], count, 0.99));
+	}
+	fprintf(out, "\r\n");
+#else
+	(void)ws;
+	fprintf(out, "\r\nDecoder statistics are not compiled in. Build with -DRS2_STATS.\r\n");
+#endif
+}
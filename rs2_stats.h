@@ -0,0 +1,63 @@
+/*
+ * File:   rs2_stats.h
+ *
+ * Created on October 17, 2026
+ */
+
+#ifndef RS2_STATS_H
+#define	RS2_STATS_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include "rs2_def_struct.h"
+
+// Decoder instrumentation, compiled in with -DRS2_STATS. Each workspace counts
+// the calls and time of every decoder stage, the decodes, fast-path exits and
+// failures, and a latency histogram by symbols corrected. Without RS2_STATS
+// the hooks below expand to nothing and the workspace carries no counters.
+
+#ifdef RS2_STATS
+// RS2StatsClock
+// Returns a timestamp: the time stamp counter on x86, else nanoseconds.
+uint64_t RS2StatsClock(void);
+
+void rs2_stats_stage(RS2_stats_struct*, int, uint64_t);
+void rs2_stats_decode(RS2_stats_struct*, int, uint64_t);
+
+#define RS2_STATS_START(t) uint64_t t = RS2StatsClock()
+#define RS2_STATS_STAGE(ws, stage, t) rs2_stats_stage(&(ws)->Stats, (stage), (t))
+#define RS2_STATS_DECODE(ws, result, t) rs2_stats_decode(&(ws)->Stats, (result), (t))
+#define RS2_STATS_FAST(ws) ((ws)->Stats.FastPath++)
+#define RS2_STATS_CLEAN(ws, count) ((ws)->Stats.Decodes += (count), (ws)->Stats.FastPath += (count))
+#else
+#define RS2_STATS_START(t)
+#define RS2_STATS_STAGE(ws, stage, t)
+#define RS2_STATS_DECODE(ws, result, t)
+#define RS2_STATS_FAST(ws)
+#define RS2_STATS_CLEAN(ws, count)
+#endif
+
+// RS2StatsEnabled
+// Returns 1 if the library was built with RS2_STATS, else 0.
+int RS2StatsEnabled(void);
+
+// RS2StatsUnit
+// Returns the name of the time unit: "cycles" or "ns".
+const char *RS2StatsUnit(void);
+
+// RS2StatsReset
+// Clears the counters of a workspace. InitRS2Work starts them cleared.
+void RS2StatsReset(RS2_work_struct*);
+
+// RS2StatsMerge
+// Adds the counters of the second workspace to the first.
+void RS2StatsMerge(RS2_work_struct*, const RS2_work_struct*);
+
+// RS2StatsDump
+// Prints a summary of the counters: per-stage calls and time, decode counts,
+// and latency percentiles by symbols corrected.
+// Arg1: output stream
+// Arg2: workspace, usually with the other threads' counters merged in
+void RS2StatsDump(FILE*, const RS2_work_struct*);
+
+#endif	/* RS2_STATS_H */
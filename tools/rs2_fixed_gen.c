@@ -0,0 +1,84 @@
+/*
+ * File:   rs2_fixed_gen.c
+ *
+ * Created on October 17, 2026
+ *
+ * Writes rs2_fixed_tables.h, the constant tables behind the specialized
+ * codecs in rs2_fixed.c. Rerun after changing the code list below, then add
+ * a matching RS2_FIXED_CODEC line and registry entry to rs2_fixed.c.
+ *
+ * gcc -DRS2_NO_FIXED -o bin/rs2-fixed-gen tools/rs2_fixed_gen.c gf2.c gf2_fft.c gf2_poly.c gf2_region.c rs2.c rs2_fixed.c rs2_pool.c rs2_stats.c -pthread
+ * bin/rs2-fixed-gen > rs2_fixed_tables.h
+ */
+
+#include <stdio.h>
+#include "../gf2.h"
+#include "../rs2.h"
+
+typedef struct {
+	int gen_poly;
+	int first_root;
+	int block_size;
+	int message_size;
+} Fixed_code_def_struct;
+
+// Codes to specialize. Fields of 8 bits or less only.
+const Fixed_code_def_struct codes[] = {
+	{285, 0, 255, 223},
+	{285, 0, 15, 13},
+};
+
+void print_table(const char *name, const char *suffix, const int *values, int count) {
+	printf("static const uint8_t %s_%s[%i] = {", name, suffix, count);
+	for (int i = 0; i < count; i++) {
+		if ((i % 16) == 0) {
+			printf("\r\n\t");
+		}
+		printf("%i,", values[i]);
+		if ((i % 16) != 15) {
+			printf(" ");
+		}
+	}
+	printf("\r\n};\r\n\r\n");
+}
+
+int main(void) {
+	static int values[256 * RS2_MAX_ROOTS8];
+	printf("/*\r\n * File:   rs2_fixed_tables.h\r\n *\r\n");
+	printf(" * Generated by tools/rs2_fixed_gen.c. Do not edit.\r\n */\r\n\r\n");
+	printf("#ifndef RS2_FIXED_TABLES_H\r\n#define\tRS2_FIXED_TABLES_H\r\n\r\n");
+	printf("#include <stdint.h>\r\n\r\n");
+	for (int c = 0; c < (int)(sizeof(codes) / sizeof(codes[0])); c++) {
+		GF2_def_struct gf;
+		RS2_def_struct rs;
+		if ((InitGF2(codes[c].gen_poly, &gf) != 0) || (gf.Power > 8)) {
+			fprintf(stderr, "Galois Field %i is not usable.\n", codes[c].gen_poly);
+			return(-1);
+		}
+		int num_roots = codes[c].block_size - codes[c].message_size;
+		rs.GF = &gf;
+		InitRS2(codes[c].first_root, num_roots, &rs);
+		char name[64];
+		snprintf(name, sizeof(name), "rs2_fixed_%i_%i_%i_%i", codes[c].gen_poly, codes[c].first_root, codes[c].block_size, codes[c].message_size);
+		printf("// GF %i, first root %i, (%i, %i)\r\n\r\n", codes[c].gen_poly, codes[c].first_root, codes[c].block_size, codes[c].message_size);
+		// Generator polynomial, lowest power first, to check against InitRS2.
+		for (int i = 0; i <= num_roots; i++) {
+			values[i] = rs.Genpoly[i];
+		}
+		print_table(name, "genpoly", values, num_roots + 1);
+		// Encoder product rows, as RS2_def_struct.EncodeTable8.
+		for (int i = 0; i < gf.Order * num_roots; i++) {
+			values[i] = rs.EncodeTable8[i];
+		}
+		print_table(name, "encode", values, gf.Order * num_roots);
+		// Horner rows, as RS2_def_struct.MulRootTable16.
+		for (int i = 0; i < gf.Order * num_roots; i++) {
+			values[i] = rs.MulRootTable16[i];
+		}
+		print_table(name, "mulroot", values, gf.Order * num_roots);
+		FreeRS2(&rs);
+		FreeGF2(&gf);
+	}
+	printf("#endif\t/* RS2_FIXED_TABLES_H */\r\n");
+	return 0;
+}
@@ -0,0 +1,604 @@
+/*
+ * File:   rs2_stream.c
+ *
+ * Created on October 17, 2026
+ *
+ * Streaming Reed Solomon codec for files and pipes. Encode slices the input
+ * into groups of 'depth' messages of k bytes, interleaves them symbol by
+ * symbol (symbol j of codeword b at offset (j * depth) + b), and writes n *
+ * depth bytes per group, so a burst of up to depth * (n - k) / 2 bytes hits
+ * each codeword at most (n - k) / 2 times. The last group ends with the input
+ * length as 8 little-endian bytes, after zero padding. Decode reads the
+ * 32-byte header for the code parameters, corrects each group in place and
+ * writes the messages back out in order.
+ *
+ * Regular files are mapped with mmap. Pipes are read by a second thread into
+ * two alternating buffers, so reading overlaps coding.
+ *
+ * gcc -O2 -o bin/rs-stream tools/rs2_stream.c gf2.c gf2_fft.c gf2_poly.c gf2_region.c rs2.c rs2_fixed.c rs2_pool.c rs2_stats.c -pthread
+ * bin/rs-stream encode -n 255 -k 223 -d 16 -i file -o file.rs
+ * bin/rs-stream decode -i file.rs -o file
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "../gf2.h"
+#include "../rs2.h"
+
+#define STREAM_MAGIC "RS2S"
+#define STREAM_VERSION 1
+#define STREAM_HEADER_SIZE 32
+#define STREAM_LENGTH_SIZE 8
+#define STREAM_CHUNK_SIZE (1 << 20)
+#define STREAM_MAX_DEPTH 65536
+// Below this depth, codewords are coded one at a time: the batch kernels
+// only pay off on wide rows.
+#define STREAM_BATCH_MIN 64
+
+// Input source: a read-only mapping of a regular file, or a reader thread
+// filling two alternating buffers from a pipe.
+typedef struct {
+	int fd;
+	const uint8_t *map;
+	size_t map_size;
+	size_t map_offset;
+	size_t chunk;
+	uint8_t *buffers[2];
+	size_t lengths[2];
+	int ready[2];
+	int error;
+	int slot;
+	int held;
+	int finished;
+	int threaded;
+	pthread_t thread;
+	pthread_mutex_t lock;
+	pthread_cond_t cond;
+} Reader_def_struct;
+
+// Reads until 'size' bytes or end of input. Returns the byte count, or -1 on
+// a read error.
+long ReadFull(int fd, uint8_t *buffer, size_t size) {
+	size_t total = 0;
+	while (total < size) {
+		ssize_t count = read(fd, &buffer[total], size - total);
+		if (count < 0) {
+			return(-1);
+		}
+		if (count == 0) {
+			break;
+		}
+		total += (size_t)count;
+	}
+	return((long)total);
+}
+
+// ReaderOpen
+// Maps the input if it is a nonempty regular file, else leaves it for the
+// reader thread.
+void ReaderOpen(int fd, Reader_def_struct *reader) {
+	memset(reader, 0, sizeof(*reader));
+	reader->fd = fd;
+	struct stat info;
+	if ((fstat(fd, &info) == 0) && S_ISREG(info.st_mode) && (info.st_size > 0)) {
+		void *map = mmap(NULL, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+		if (map != MAP_FAILED) {
+			madvise(map, (size_t)info.st_size, MADV_SEQUENTIAL);
+			reader->map = (const uint8_t *)map;
+			reader->map_size = (size_t)info.st_size;
+		}
+	}
+}
+
+// ReaderHeader
+// Reads the stream header ahead of the data chunks.
+// Returns the byte count read.
+long ReaderHeader(uint8_t *header, size_t size, Reader_def_struct *reader) {
+	if (reader->map != NULL) {
+		size_t count = (reader->map_size < size) ? reader->map_size : size;
+		memcpy(header, reader->map, count);
+		reader->map_offset = count;
+		return((long)count);
+	}
+	return(ReadFull(reader->fd, header, size));
+}
+
+void *ReaderThread(void *arg) {
+	Reader_def_struct *reader = (Reader_def_struct *)arg;
+	int slot = 0;
+	for (;;) {
+		pthread_mutex_lock(&reader->lock);
+		while (reader->ready[slot]) {
+			pthread_cond_wait(&reader->cond, &reader->lock);
+		}
+		pthread_mutex_unlock(&reader->lock);
+		long count = ReadFull(reader->fd, reader->buffers[slot], reader->chunk);
+		pthread_mutex_lock(&reader->lock);
+		if (count < 0) {
+			reader->error = 1;
+			count = 0;
+		}
+		reader->lengths[slot] = (size_t)count;
+		reader->ready[slot] = 1;
+		pthread_cond_broadcast(&reader->cond);
+		pthread_mutex_unlock(&reader->lock);
+		// A short chunk marks the end of input.
+		if ((size_t)count < reader->chunk) {
+			break;
+		}
+		slot ^= 1;
+	}
+	return(NULL);
+}
+
+// ReaderStart
+// Sets the chunk size handed out by ReaderNext, and starts the reader thread
+// for unmapped input.
+// Returns 0 on success, -1 if the buffers or thread could not be created.
+int ReaderStart(size_t chunk, Reader_def_struct *reader) {
+	reader->chunk = chunk;
+	if (reader->map != NULL) {
+		return(0);
+	}
+	reader->buffers[0] = (uint8_t *)malloc(chunk);
+	reader->buffers[1] = (uint8_t *)malloc(chunk);
+	if ((reader->buffers[0] == NULL) || (reader->buffers[1] == NULL)) {
+		return(-1);
+	}
+	pthread_mutex_init(&reader->lock, NULL);
+	pthread_cond_init(&reader->cond, NULL);
+	if (pthread_create(&reader->thread, NULL, ReaderThread, reader) != 0) {
+		return(-1);
+	}
+	reader->threaded = 1;
+	return(0);
+}
+
+// ReaderNext
+// Hands out the next chunk, which stays valid until the following call. Every
+// chunk but the last is full size.
+// Returns the byte count, 0 at end of input.
+size_t ReaderNext(const uint8_t **data, Reader_def_struct *reader) {
+	if (reader->map != NULL) {
+		size_t count = reader->map_size - reader->map_offset;
+		if (count > reader->chunk) {
+			count = reader->chunk;
+		}
+		*data = &reader->map[reader->map_offset];
+		reader->map_offset += count;
+		return(count);
+	}
+	if (reader->finished || !reader->threaded) {
+		return(0);
+	}
+	pthread_mutex_lock(&reader->lock);
+	if (reader->held) {
+		// Give the previous buffer back to the reader thread.
+		reader->ready[reader->slot] = 0;
+		pthread_cond_broadcast(&reader->cond);
+		reader->slot ^= 1;
+	}
+	while (!reader->ready[reader->slot]) {
+		pthread_cond_wait(&reader->cond, &reader->lock);
+	}
+	size_t count = reader->lengths[reader->slot];
+	pthread_mutex_unlock(&reader->lock);
+	reader->held = 1;
+	if (count < reader->chunk) {
+		reader->finished = 1;
+	}
+	*data = reader->buffers[reader->slot];
+	return(count);
+}
+
+// ReaderClose
+// Stops the reader thread and releases the buffers or mapping.
+void ReaderClose(Reader_def_struct *reader) {
+	if (reader->threaded) {
+		if (!reader->finished) {
+			// Drain so the thread reaches end of input and exits.
+			const uint8_t *data;
+			while (ReaderNext(&data, reader) > 0) {
+			}
+		}
+		pthread_join(reader->thread, NULL);
+		pthread_mutex_destroy(&reader->lock);
+		pthread_cond_destroy(&reader->cond);
+	}
+	free(reader->buffers[0]);
+	free(reader->buffers[1]);
+	if (reader->map != NULL) {
+		munmap((void *)reader->map, reader->map_size);
+	}
+}
+
+void PutLE(uint8_t *buffer, uint64_t value, int size) {
+	for (int i = 0; i < size; i++) {
+		buffer[i] = (uint8_t)(value >> (8 * i));
+	}
+}
+
+uint64_t GetLE(const uint8_t *buffer, int size) {
+	uint64_t value = 0;
+	for (int i = 0; i < size; i++) {
+		value |= (uint64_t)buffer[i] << (8 * i);
+	}
+	return(value);
+}
+
+// Stream parameters, from the command line or the header.
+typedef struct {
+	int gen_poly;
+	int first_root;
+	int block_size;
+	int message_size;
+	int depth;
+	int verbose;
+} Stream_def_struct;
+
+// Per-stream decoder counts.
+typedef struct {
+	long long blocks;
+	long long clean;
+	long long corrected;
+	long long symbols;
+	long long failed;
+} Stream_stats_struct;
+
+double Seconds(void) {
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return((double)now.tv_sec + (now.tv_nsec * 1e-9));
+}
+
+// Interleaves one group of 'depth' messages into the codeword layout.
+void Interleave(uint8_t *blocks, const uint8_t *messages, const Stream_def_struct *p) {
+	int k = p->message_size;
+	int depth = p->depth;
+	for (int b = 0; b < depth; b++) {
+		const uint8_t *message = &messages[(size_t)b * k];
+		for (int j = 0; j < k; j++) {
+			blocks[((size_t)j * depth) + b] = message[j];
+		}
+	}
+}
+
+// Gathers the messages of one decoded group back into input order.
+void Deinterleave(uint8_t *messages, const uint8_t *blocks, const Stream_def_struct *p) {
+	int k = p->message_size;
+	int depth = p->depth;
+	for (int b = 0; b < depth; b++) {
+		uint8_t *message = &messages[(size_t)b * k];
+		for (int j = 0; j < k; j++) {
+			message[j] = blocks[((size_t)j * depth) + b];
+		}
+	}
+}
+
+// Encodes one group of messages into 'blocks' and writes it.
+// Returns 0 on success, -1 on a write error.
+int EncodeGroup(uint8_t *blocks, uint8_t *codeword, const uint8_t *messages, FILE *output, const Stream_def_struct *p, const RS2_def_struct *rs) {
+	size_t group_out = (size_t)p->block_size * p->depth;
+	if (p->depth >= STREAM_BATCH_MIN) {
+		Interleave(blocks, messages, p);
+		RSEncodeBatch8(blocks, p->depth, p->message_size, rs);
+	} else {
+		for (int b = 0; b < p->depth; b++) {
+			memcpy(codeword, &messages[(size_t)b * p->message_size], p->message_size);
+			RSEncode8(codeword, p->message_size, rs);
+			for (int j = 0; j < p->block_size; j++) {
+				blocks[((size_t)j * p->depth) + b] = codeword[j];
+			}
+		}
+	}
+	return((fwrite(blocks, 1, group_out, output) == group_out) ? 0 : -1);
+}
+
+int Encode(Reader_def_struct *reader, FILE *output, const Stream_def_struct *p, const RS2_def_struct *rs) {
+	size_t group_in = (size_t)p->message_size * p->depth;
+	size_t group_out = (size_t)p->block_size * p->depth;
+	uint8_t header[STREAM_HEADER_SIZE] = {0};
+	memcpy(header, STREAM_MAGIC, 4);
+	header[4] = STREAM_VERSION;
+	PutLE(&header[8], p->gen_poly, 4);
+	PutLE(&header[12], p->first_root, 4);
+	PutLE(&header[16], p->block_size, 4);
+	PutLE(&header[20], p->message_size, 4);
+	PutLE(&header[24], p->depth, 4);
+	if (fwrite(header, 1, sizeof(header), output) != sizeof(header)) {
+		return(-1);
+	}
+	size_t groups_per_chunk = (STREAM_CHUNK_SIZE + group_in - 1) / group_in;
+	uint8_t *blocks = (uint8_t *)malloc(group_out);
+	uint8_t *codeword = (uint8_t *)malloc(p->block_size);
+	uint8_t *tail = (uint8_t *)calloc(2, group_in);
+	if ((blocks == NULL) || (codeword == NULL) || (tail == NULL) || (ReaderStart(groups_per_chunk * group_in, reader) < 0)) {
+		free(blocks);
+		free(codeword);
+		free(tail);
+		return(-1);
+	}
+	uint64_t total = 0;
+	size_t remainder = 0;
+	int status = 0;
+	const uint8_t *data;
+	size_t count;
+	while ((status == 0) && ((count = ReaderNext(&data, reader)) > 0)) {
+		total += count;
+		// Chunks are whole groups, except at the end of input.
+		size_t offset = 0;
+		for (; (status == 0) && (offset + group_in <= count); offset += group_in) {
+			status = EncodeGroup(blocks, codeword, &data[offset], output, p, rs);
+		}
+		remainder = count - offset;
+		memcpy(tail, &data[offset], remainder);
+	}
+	if (reader->error) {
+		status = -1;
+	}
+	// Final group or two: the remaining input, zero padding, and the length.
+	if (status == 0) {
+		size_t tail_groups = (remainder + STREAM_LENGTH_SIZE <= group_in) ? 1 : 2;
+		PutLE(&tail[(tail_groups * group_in) - STREAM_LENGTH_SIZE], total, STREAM_LENGTH_SIZE);
+		for (size_t g = 0; (status == 0) && (g < tail_groups); g++) {
+			status = EncodeGroup(blocks, codeword, &tail[g * group_in], output, p, rs);
+		}
+	}
+	free(blocks);
+	free(codeword);
+	free(tail);
+	return(status);
+}
+
+// Decodes one group, leaves the messages in 'messages' and reports each
+// codeword.
+void DecodeGroup(uint8_t *messages, uint8_t *blocks, uint8_t *codeword, int *results, long long first_block, Stream_stats_struct *stats, const Stream_def_struct *p, const RS2_def_struct *rs, RS2_work_struct *ws) {
+	if (p->depth >= STREAM_BATCH_MIN) {
+		RSDecodeBatch8(blocks, p->depth, p->block_size, results, rs, ws);
+		Deinterleave(messages, blocks, p);
+	} else {
+		for (int b = 0; b < p->depth; b++) {
+			for (int j = 0; j < p->block_size; j++) {
+				codeword[j] = blocks[((size_t)j * p->depth) + b];
+			}
+			results[b] = RSDecode8(codeword, p->block_size, rs, ws);
+			memcpy(&messages[(size_t)b * p->message_size], codeword, p->message_size);
+		}
+	}
+	for (int b = 0; b < p->depth; b++) {
+		stats->blocks++;
+		if (results[b] == 0) {
+			stats->clean++;
+		} else if (results[b] > 0) {
+			stats->corrected++;
+			stats->symbols += results[b];
+			if (p->verbose) {
+				fprintf(stderr, "block %lld: corrected %i\n", first_block + b, results[b]);
+			}
+		} else {
+			stats->failed++;
+			if (p->verbose) {
+				fprintf(stderr, "block %lld: failed\n", first_block + b);
+			}
+		}
+	}
+}
+
+int Decode(Reader_def_struct *reader, FILE *output, Stream_stats_struct *stats, const Stream_def_struct *p, const RS2_def_struct *rs, RS2_work_struct *ws) {
+	size_t group_in = (size_t)p->message_size * p->depth;
+	size_t group_out = (size_t)p->block_size * p->depth;
+	size_t groups_per_chunk = (STREAM_CHUNK_SIZE + group_out - 1) / group_out;
+	uint8_t *blocks = (uint8_t *)malloc(group_out);
+	uint8_t *codeword = (uint8_t *)malloc(p->block_size);
+	int *results = (int *)malloc(sizeof(int) * p->depth);
+	// The last two groups are held back: the length in the last one says how
+	// much of them is data.
+	uint8_t *held[2];
+	held[0] = (uint8_t *)malloc(group_in);
+	held[1] = (uint8_t *)malloc(group_in);
+	int status = 0;
+	if ((blocks == NULL) || (codeword == NULL) || (results == NULL) || (held[0] == NULL) || (held[1] == NULL) || (ReaderStart(groups_per_chunk * group_out, reader) < 0)) {
+		status = -1;
+	}
+	int oldest = 0;
+	int held_count = 0;
+	uint64_t written = 0;
+	long long group = 0;
+	const uint8_t *data;
+	size_t count;
+	while ((status == 0) && ((count = ReaderNext(&data, reader)) > 0)) {
+		size_t offset = 0;
+		for (; (status == 0) && (offset + group_out <= count); offset += group_out) {
+			memcpy(blocks, &data[offset], group_out);
+			uint8_t *target;
+			if (held_count == 2) {
+				if (fwrite(held[oldest], 1, group_in, output) != group_in) {
+					status = -1;
+				}
+				written += group_in;
+				target = held[oldest];
+				oldest ^= 1;
+			} else {
+				target = held[(oldest + held_count) & 1];
+				held_count++;
+			}
+			DecodeGroup(target, blocks, codeword, results, group * p->depth, stats, p, rs, ws);
+			group++;
+		}
+		if (offset != count) {
+			fprintf(stderr, "Input ends inside a group.\n");
+			status = -1;
+		}
+	}
+	if (reader->error) {
+		fprintf(stderr, "Read error.\n");
+		status = -1;
+	}
+	if ((status == 0) && (held_count == 0)) {
+		fprintf(stderr, "No data after the header.\n");
+		status = -1;
+	}
+	if (status == 0) {
+		uint64_t length = GetLE(&held[(oldest + held_count - 1) & 1][group_in - STREAM_LENGTH_SIZE], STREAM_LENGTH_SIZE);
+		uint64_t pending = (held_count * group_in) - STREAM_LENGTH_SIZE;
+		if ((length < written) || (length - written > pending)) {
+			// The length is lost; keep everything but the length field itself.
+			fprintf(stderr, "Stream length is corrupt, output may carry padding.\n");
+			length = written + pending;
+			status = -1;
+		}
+		uint64_t remaining = length - written;
+		for (int i = 0; (i < held_count) && (remaining > 0); i++) {
+			size_t size = (remaining < group_in) ? (size_t)remaining : group_in;
+			if (fwrite(held[(oldest + i) & 1], 1, size, output) != size) {
+				status = -1;
+			}
+			remaining -= size;
+		}
+	}
+	free(blocks);
+	free(codeword);
+	free(results);
+	free(held[0]);
+	free(held[1]);
+	return(status);
+}
+
+void Usage(void) {
+	fprintf(stderr, "Usage:\n");
+	fprintf(stderr, "rs-stream encode [-p <gf poly>] [-r <rs first root>] [-n <block size>] [-k <message size>] [-d <depth>] [-i <input>] [-o <output>]\n");
+	fprintf(stderr, "rs-stream decode [-v] [-i <input>] [-o <output>]\n");
+	fprintf(stderr, "\nDefaults: -p 285 -r 0 -n 255 -k 223 -d 1, standard input and output.\n");
+	fprintf(stderr, "Fields of 8 bits or less. -d interleaves that many codewords per group.\n");
+	fprintf(stderr, "-v reports each corrected or failed block.\n");
+}
+
+int main(int arg_count, char* arg_values[]) {
+	if ((arg_count < 2) || ((strcmp(arg_values[1], "encode") != 0) && (strcmp(arg_values[1], "decode") != 0))) {
+		Usage();
+		return(-1);
+	}
+	int encode = (strcmp(arg_values[1], "encode") == 0);
+	Stream_def_struct p = {285, 0, 255, 223, 1, 0};
+	const char *input_name = "-";
+	const char *output_name = "-";
+	for (int i = 2; i < arg_count; i++) {
+		const char *option = arg_values[i];
+		if ((option[0] != '-') || (option[1] == 0) || (option[2] != 0)) {
+			fprintf(stderr, "Unknown option %s.\n", option);
+			return(-1);
+		}
+		if (option[1] == 'v') {
+			p.verbose = 1;
+			continue;
+		}
+		if (i + 1 >= arg_count) {
+			fprintf(stderr, "Option %s needs a value.\n", option);
+			return(-1);
+		}
+		const char *value = arg_values[++i];
+		switch (option[1]) {
+			case 'p': p.gen_poly = atoi(value); break;
+			case 'r': p.first_root = atoi(value); break;
+			case 'n': p.block_size = atoi(value); break;
+			case 'k': p.message_size = atoi(value); break;
+			case 'd': p.depth = atoi(value); break;
+			case 'i': input_name = value; break;
+			case 'o': output_name = value; break;
+			default:
+				fprintf(stderr, "Unknown option %s.\n", option);
+				return(-1);
+		}
+	}
+
+	int input_fd = (strcmp(input_name, "-") == 0) ? STDIN_FILENO : open(input_name, O_RDONLY);
+	if (input_fd < 0) {
+		fprintf(stderr, "Cannot open %s.\n", input_name);
+		return(-1);
+	}
+	Reader_def_struct reader;
+	ReaderOpen(input_fd, &reader);
+	if (!encode) {
+		uint8_t header[STREAM_HEADER_SIZE];
+		if ((ReaderHeader(header, sizeof(header), &reader) != sizeof(header)) || (memcmp(header, STREAM_MAGIC, 4) != 0) || (header[4] != STREAM_VERSION)) {
+			fprintf(stderr, "Input is not an rs-stream version %i stream.\n", STREAM_VERSION);
+			return(-1);
+		}
+		p.gen_poly = (int)GetLE(&header[8], 4);
+		p.first_root = (int)GetLE(&header[12], 4);
+		p.block_size = (int)GetLE(&header[16], 4);
+		p.message_size = (int)GetLE(&header[20], 4);
+		p.depth = (int)GetLE(&header[24], 4);
+	}
+
+	GF2_def_struct gf;
+	if ((InitGF2(p.gen_poly, &gf) != 0) || (gf.Power > 8)) {
+		fprintf(stderr, "Galois Field %i is not usable. Fields of 8 bits or less only.\n", p.gen_poly);
+		return(-1);
+	}
+	if ((p.block_size > gf.Order - 1) || (p.message_size < 1) || (p.message_size >= p.block_size)) {
+		fprintf(stderr, "Block size %i and message size %i are not usable in GF %i.\n", p.block_size, p.message_size, p.gen_poly);
+		return(-1);
+	}
+	if ((p.depth < 1) || (p.depth > STREAM_MAX_DEPTH) || ((size_t)p.message_size * p.depth < STREAM_LENGTH_SIZE)) {
+		fprintf(stderr, "Depth %i is not usable. Need 1 to %i, with at least %i message bytes per group.\n", p.depth, STREAM_MAX_DEPTH, STREAM_LENGTH_SIZE);
+		return(-1);
+	}
+	RS2_def_struct rs;
+	RS2_work_struct ws;
+	rs.GF = &gf;
+	if ((InitRS2(p.first_root, p.block_size - p.message_size, &rs) < 0) || (InitRS2Work(&rs, &ws) < 0)) {
+		fprintf(stderr, "Out of memory.\n");
+		return(-1);
+	}
+
+	FILE *output = (strcmp(output_name, "-") == 0) ? stdout : fopen(output_name, "wb");
+	if (output == NULL) {
+		fprintf(stderr, "Cannot open %s.\n", output_name);
+		return(-1);
+	}
+	setvbuf(output, NULL, _IOFBF, STREAM_CHUNK_SIZE);
+
+	double start = Seconds();
+	Stream_stats_struct stats = {0, 0, 0, 0, 0};
+	int status;
+	if (encode) {
+		status = Encode(&reader, output, &p, &rs);
+	} else {
+		status = Decode(&reader, output, &stats, &p, &rs, &ws);
+	}
+	if (fflush(output) != 0) {
+		status = -1;
+	}
+	double seconds = Seconds() - start;
+	if (status < 0) {
+		fprintf(stderr, "%s failed.\n", encode ? "Encode" : "Decode");
+	}
+	if (!encode) {
+		fprintf(stderr, "%lld blocks: %lld clean, %lld corrected (%lld symbols), %lld failed, %.3f s\n",
+			stats.blocks, stats.clean, stats.corrected, stats.symbols, stats.failed, seconds);
+	}
+
+	ReaderClose(&reader);
+	if (output != stdout) {
+		fclose(output);
+	}
+	if (input_fd != STDIN_FILENO) {
+		close(input_fd);
+	}
+	FreeRS2Work(&ws);
+	FreeRS2(&rs);
+	FreeGF2(&gf);
+	if (status < 0) {
+		return(-1);
+	}
+	return((stats.failed > 0) ? 1 : 0);
+}